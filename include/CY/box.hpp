@@ -0,0 +1,177 @@
+/**
+ * @file box.hpp
+ * @author Jesús Blanco
+ * @brief A non-nullable owning pointer (`Box<T>`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "safety.hpp"
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace cy {
+template<typename T, typename Alloc = std::allocator<T>>
+class Box;
+
+template<typename T, typename Alloc, typename... Args>
+Box<T, Alloc> allocate_box(Alloc const &alloc, Args &&...args);
+
+/**
+ * @brief An owning pointer to a heap allocated `T` which is never null.
+ *
+ * The null pointer is declared as the niche of `Box<T>`, so `Maybe<Box<T>>`
+ * is the size of a pointer and checking for `None` is a pointer test. A
+ * moved-from `Box<T>` is left in that state, and may only be destroyed or
+ * assigned to.
+ *
+ * With a stateless `Alloc` (the default), `Box<T>` is the size of a pointer.
+ *
+ * @ref make_box
+ * @ref allocate_box
+ */
+template<typename T, typename Alloc>
+class Box : private Alloc
+{
+    static_assert(!std::is_void_v<T>, "Box<void> is invalid.");
+    static_assert(
+        std::is_same_v<typename std::allocator_traits<Alloc>::value_type, T>,
+        "Box<T, Alloc> requires an allocator of T.");
+
+  private:
+    using Traits = std::allocator_traits<Alloc>;
+
+    T *ptr;
+
+    Box(T *ptr, Alloc const &alloc)
+        : Alloc(alloc)
+        , ptr(ptr)
+    {
+    }
+
+    inline Alloc &allocator() { return *this; }
+
+    void destroy()
+    {
+        if (this->ptr == nullptr)
+            return;
+
+        Traits::destroy(this->allocator(), this->ptr);
+        Traits::deallocate(this->allocator(), this->ptr, 1);
+    }
+
+  public:
+    friend Niche<Box<T, Alloc>>;
+
+    template<typename U, typename A, typename... Args>
+    friend Box<U, A> allocate_box(A const &alloc, Args &&...args);
+
+    ~Box() { this->destroy(); }
+
+    Box(Box const &) = delete;
+    Box &operator=(Box const &) = delete;
+
+    Box(Box &&other) noexcept
+        : Alloc(std::move(other.allocator()))
+        , ptr(std::exchange(other.ptr, nullptr))
+    {
+    }
+
+    Box &operator=(Box &&other) noexcept
+    {
+        if (this != &other) {
+            this->destroy();
+            this->allocator() = std::move(other.allocator());
+            this->ptr = std::exchange(other.ptr, nullptr);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Gets a const reference to `T` (`T const&`).
+     */
+    inline T const &get() const { return *this->ptr; }
+    /**
+     * @brief Gets a reference to `T` (`T&`).
+     */
+    inline T &get() { return *this->ptr; }
+
+    inline T const &operator*() const { return *this->ptr; }
+    inline T       &operator*() { return *this->ptr; }
+    inline T const *operator->() const { return this->ptr; }
+    inline T       *operator->() { return this->ptr; }
+
+    /**
+     * @brief Gets the raw pointer to `T`. Ownership is kept by `Box<T>`.
+     */
+    inline T const *as_ptr() const { return this->ptr; }
+    /**
+     * @brief Gets the raw pointer to `T`. Ownership is kept by `Box<T>`.
+     */
+    inline T *as_ptr() { return this->ptr; }
+
+    /**
+     * @brief Gets a copy of the allocator used by this `Box<T>`.
+     */
+    inline Alloc get_allocator() const { return *this; }
+};
+
+/**
+ * @brief Allocates and constructs a `T` using `alloc`, wrapping it into a
+ * `Box<T, Alloc>`.
+ *
+ * @exception Whatever `alloc` or the constructor of `T` throws. Nothing is
+ * leaked if the constructor throws.
+ */
+template<typename T, typename Alloc, typename... Args>
+Box<T, Alloc> allocate_box(Alloc const &alloc, Args &&...args)
+{
+    using Traits = std::allocator_traits<Alloc>;
+
+    Alloc a(alloc);
+    T    *ptr = Traits::allocate(a, 1);
+
+    try {
+        Traits::construct(a, ptr, std::forward<Args>(args)...);
+    } catch (...) {
+        Traits::deallocate(a, ptr, 1);
+        throw;
+    }
+
+    return Box<T, Alloc>(ptr, a);
+}
+
+/**
+ * @brief Allocates and constructs a `T` on the heap, wrapping it into a
+ * `Box<T>`.
+ */
+template<typename T, typename... Args>
+Box<T> make_box(Args &&...args)
+{
+    return allocate_box<T>(std::allocator<T>(), std::forward<Args>(args)...);
+}
+
+/**
+ * @brief The niche of `Box<T>` is the null pointer, which is also its
+ * moved-from state.
+ */
+template<typename T, typename Alloc>
+struct Niche<Box<T, Alloc>>
+{
+    static constexpr bool value = true;
+
+    static Box<T, Alloc> none() { return Box<T, Alloc>(nullptr, Alloc()); }
+    static bool          is_none(Box<T, Alloc> const &box)
+    {
+        return box.ptr == nullptr;
+    }
+};
+}
@@ -0,0 +1,856 @@
+/**
+ * @file btree_map.hpp
+ * @author Jesús Blanco
+ * @brief An ordered map kept in a B+tree of wide nodes (`BTreeMap<K, V>`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "iter.hpp"
+#include "safety.hpp"
+#include "types.hpp"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cy {
+namespace detail {
+/**
+ * @brief Keys a node of a `BTreeMap<K, V>` holds: as many as fit in four
+ * cache lines, between 8 and 64.
+ */
+template<typename K>
+constexpr usize btree_capacity = std::clamp<usize>(256 / sizeof(K), 8, 64);
+
+/**
+ * @brief Whether nodes keyed by `K` are searched by comparing every slot.
+ * Their unused slots hold the largest `K`, which is never less than the key
+ * searched for.
+ */
+template<typename K>
+constexpr bool btree_padded =
+    std::is_integral_v<K> && !std::is_same_v<K, bool>;
+
+template<typename K>
+struct BTreeNode
+{
+    usize len = 0;
+    K     keys[btree_capacity<K>];
+
+    BTreeNode()
+    {
+        if constexpr (btree_padded<K>)
+            std::fill(this->keys,
+                      this->keys + btree_capacity<K>,
+                      std::numeric_limits<K>::max());
+    }
+
+    /**
+     * @brief Drops the keys from `new_len` on.
+     */
+    inline void shrink(usize new_len)
+    {
+        if constexpr (btree_padded<K>)
+            std::fill(this->keys + new_len,
+                      this->keys + this->len,
+                      std::numeric_limits<K>::max());
+
+        this->len = new_len;
+    }
+};
+
+/**
+ * @brief Leaves hold the entries, and are linked in key order.
+ */
+template<typename K, typename V>
+struct BTreeLeaf : BTreeNode<K>
+{
+    V          values[btree_capacity<K>]{};
+    BTreeLeaf *prev = nullptr;
+    BTreeLeaf *next = nullptr;
+};
+
+/**
+ * @brief `keys[i]` is the largest key under `children[i]` (or larger); the
+ * last child has no key.
+ */
+template<typename K>
+struct BTreeInner : BTreeNode<K>
+{
+    BTreeNode<K> *children[btree_capacity<K> + 1]{};
+};
+
+/**
+ * @brief Position of the first of the `len` sorted `keys` that is not less
+ * than `key`.
+ */
+template<typename K>
+inline usize btree_search(K const *keys, usize len, K const &key)
+{
+    if constexpr (btree_padded<K>) {
+        // Counts the keys less than `key` in every slot, padding included,
+        // without branching: a fixed number of compares, which the compiler
+        // turns into vector ones where the target has them.
+        std::make_unsigned_t<K> position = 0;
+        for (usize i = 0; i < btree_capacity<K>; i++)
+            position += keys[i] < key;
+
+        return position;
+    } else {
+        return std::lower_bound(keys, keys + len, key) - keys;
+    }
+}
+}
+
+/**
+ * @brief Iterates over entries of a `BTreeMap<K, V>` in key order, yielding
+ * `std::pair<K const &, V &>` (`V` is const for const maps).
+ */
+template<typename K, typename V>
+class BTreeIter : public Iter<BTreeIter<K, V>, std::pair<K const &, V &>>
+{
+  private:
+    using Leaf =
+        std::conditional_t<std::is_const_v<V>,
+                           detail::BTreeLeaf<K, std::remove_const_t<V>> const,
+                           detail::BTreeLeaf<K, V>>;
+    using Entry = std::pair<K const &, V &>;
+
+    // Next entry, and the one to stop at ({ nullptr, 0 } for the end).
+    Leaf *leaf;
+    usize index;
+    Leaf *last_leaf;
+    usize last_index;
+
+  public:
+    BTreeIter(Leaf *leaf, usize index, Leaf *last_leaf, usize last_index)
+        : leaf(leaf)
+        , index(index)
+        , last_leaf(last_leaf)
+        , last_index(last_index)
+    {
+    }
+
+    inline Maybe<Entry> next()
+    {
+        if (this->leaf == this->last_leaf && this->index == this->last_index)
+            return None();
+
+        Entry entry(this->leaf->keys[this->index],
+                    this->leaf->values[this->index]);
+        if (++this->index == this->leaf->len) {
+            this->leaf = this->leaf->next;
+            this->index = 0;
+        }
+
+        return Some(entry);
+    }
+
+    /**
+     * @brief Drains the iterator a leaf at a time.
+     */
+    template<typename Acc, typename F>
+    Acc fold(Acc acc, F &&func)
+    {
+        while (this->leaf != nullptr) {
+            bool  last = this->leaf == this->last_leaf;
+            usize stop = last ? this->last_index : this->leaf->len;
+
+            for (; this->index < stop; this->index++)
+                acc = func(std::move(acc),
+                           Entry(this->leaf->keys[this->index],
+                                 this->leaf->values[this->index]));
+
+            if (last)
+                break;
+
+            this->leaf = this->leaf->next;
+            this->index = 0;
+        }
+
+        return acc;
+    }
+};
+
+/**
+ * @brief An ordered map from `K` to `V`, like `std::map`, kept in a B+tree:
+ * entries are stored sorted in leaves of up to `CAPACITY` keys (four cache
+ * lines' worth), linked to each other, under inner nodes just as wide. A
+ * lookup goes through a handful of nodes, scanning contiguous keys in each
+ * (without branching, for integer keys), and a range scan walks leaves
+ * instead of chasing a pointer per entry.
+ *
+ * `from_sorted` builds the tree bottom-up from sorted entries, with full
+ * leaves. Appending keys in order also fills leaves up rather than leaving
+ * them half empty.
+ *
+ * @attention `K` and `V` must be default constructible and movable, and `K`
+ * copyable (inner nodes hold copies of keys), with a strict weak order `<`.
+ * Inserting or removing invalidates references to entries and iterators.
+ *
+ * @code
+ * cy::BTreeMap<uint64, std::string> names;
+ * names.insert(7, "seven");
+ *
+ * if (auto name = names.get(7); name.is_some())
+ *     name.get() += "!";
+ *
+ * usize below_100 = names.range(0, 100).fold(
+ *     usize(0), [](usize n, auto) { return n + 1; });
+ * @endcode
+ */
+template<typename K, typename V>
+class BTreeMap
+{
+  public:
+    static constexpr usize CAPACITY = detail::btree_capacity<K>;
+
+    using Entry = std::pair<K const &, V &>;
+    using ConstEntry = std::pair<K const &, V const &>;
+
+  private:
+    using Node = detail::BTreeNode<K>;
+    using Leaf = detail::BTreeLeaf<K, V>;
+    using Inner = detail::BTreeInner<K>;
+
+    /// @brief Fewest keys a node other than the root holds after a removal.
+    static constexpr usize MIN = CAPACITY / 2;
+
+    Node *root = nullptr;
+    /// @brief Inner levels above the leaves.
+    usize height = 0;
+    usize count = 0;
+    Leaf *head = nullptr;
+    Leaf *tail = nullptr;
+
+    static inline usize search(Node const *node, K const &key)
+    {
+        return detail::btree_search(node->keys, node->len, key);
+    }
+
+    static void destroy(Node *node, usize level)
+    {
+        if (level == 0) {
+            delete static_cast<Leaf *>(node);
+            return;
+        }
+
+        auto *inner = static_cast<Inner *>(node);
+        for (usize i = 0; i <= inner->len; i++)
+            destroy(inner->children[i], level - 1);
+
+        delete inner;
+    }
+
+    /**
+     * @brief The leaf `key` is in or belongs in, and its position there.
+     */
+    std::pair<Leaf *, usize> find(K const &key) const
+    {
+        Node *node = this->root;
+        for (usize level = this->height; level > 0; level--)
+            node = static_cast<Inner *>(node)->children[search(node, key)];
+
+        return { static_cast<Leaf *>(node), search(node, key) };
+    }
+
+    /**
+     * @brief The position of the first entry not less than `key`, moved to
+     * the next leaf if past the end of one.
+     */
+    std::pair<Leaf *, usize> lower_bound(K const &key) const
+    {
+        if (this->root == nullptr)
+            return { nullptr, 0 };
+
+        auto [leaf, index] = this->find(key);
+        if (index == leaf->len)
+            return { leaf->next, 0 };
+
+        return { leaf, index };
+    }
+
+    static void insert_entry(Leaf *leaf, usize i, K &key, V &value)
+    {
+        std::move_backward(
+            leaf->keys + i, leaf->keys + leaf->len, leaf->keys + leaf->len + 1);
+        std::move_backward(leaf->values + i,
+                           leaf->values + leaf->len,
+                           leaf->values + leaf->len + 1);
+        leaf->keys[i] = std::move(key);
+        leaf->values[i] = std::move(value);
+        leaf->len++;
+    }
+
+    /**
+     * @brief Puts `child`, holding keys up to the old `keys[i]`, right after
+     * `children[i]`, which now holds keys up to `key`.
+     */
+    static void insert_child(Inner *inner, usize i, K &key, Node *child)
+    {
+        std::move_backward(inner->keys + i,
+                           inner->keys + inner->len,
+                           inner->keys + inner->len + 1);
+        std::move_backward(inner->children + i + 1,
+                           inner->children + inner->len + 1,
+                           inner->children + inner->len + 2);
+        inner->keys[i] = std::move(key);
+        inner->children[i + 1] = child;
+        inner->len++;
+    }
+
+    /**
+     * @brief Inserts into the subtree under `node`, `level`s above the leaves.
+     *
+     * @return The new node right of `node` if it split, whose keys are all
+     * greater than `separator`; `nullptr` otherwise.
+     */
+    Node *insert_into(Node     *node,
+                      usize     level,
+                      K        &key,
+                      V        &value,
+                      Maybe<V> &old,
+                      K        &separator)
+    {
+        usize i = search(node, key);
+
+        if (level == 0) {
+            auto *leaf = static_cast<Leaf *>(node);
+            if (i < leaf->len && !(key < leaf->keys[i])) {
+                old = Some(std::exchange(leaf->values[i], std::move(value)));
+                return nullptr;
+            }
+
+            this->count++;
+            if (leaf->len < CAPACITY) {
+                insert_entry(leaf, i, key, value);
+                return nullptr;
+            }
+
+            // Appending to the last leaf leaves it full: keys coming in order
+            // fill leaves up.
+            usize half = i == CAPACITY && leaf == this->tail ? CAPACITY
+                                                             : CAPACITY / 2;
+            auto *right = new Leaf();
+            std::move(leaf->keys + half, leaf->keys + CAPACITY, right->keys);
+            std::move(
+                leaf->values + half, leaf->values + CAPACITY, right->values);
+            right->len = CAPACITY - half;
+            leaf->shrink(half);
+
+            right->prev = leaf;
+            right->next = leaf->next;
+            if (leaf->next != nullptr)
+                leaf->next->prev = right;
+            else
+                this->tail = right;
+            leaf->next = right;
+
+            if (i <= half && half < CAPACITY)
+                insert_entry(leaf, i, key, value);
+            else
+                insert_entry(right, i - half, key, value);
+
+            separator = leaf->keys[leaf->len - 1];
+            return right;
+        }
+
+        auto *inner = static_cast<Inner *>(node);
+        K     child_separator{};
+        Node *child = this->insert_into(
+            inner->children[i], level - 1, key, value, old, child_separator);
+        if (child == nullptr)
+            return nullptr;
+
+        if (inner->len < CAPACITY) {
+            insert_child(inner, i, child_separator, child);
+            return nullptr;
+        }
+
+        usize mid = CAPACITY / 2;
+        auto *right = new Inner();
+        std::move(inner->keys + mid + 1, inner->keys + CAPACITY, right->keys);
+        std::copy(inner->children + mid + 1,
+                  inner->children + CAPACITY + 1,
+                  right->children);
+        right->len = CAPACITY - mid - 1;
+        separator = std::move(inner->keys[mid]);
+        inner->shrink(mid);
+
+        if (i <= mid)
+            insert_child(inner, i, child_separator, child);
+        else
+            insert_child(right, i - mid - 1, child_separator, child);
+
+        return right;
+    }
+
+    /**
+     * @brief Moves the last entry of `children[i - 1]` to `children[i]`.
+     */
+    static void borrow_left(Inner *parent, usize i, usize level)
+    {
+        Node *left = parent->children[i - 1];
+        Node *node = parent->children[i];
+
+        std::move_backward(
+            node->keys, node->keys + node->len, node->keys + node->len + 1);
+        if (level == 0) {
+            auto *from = static_cast<Leaf *>(left);
+            auto *to = static_cast<Leaf *>(node);
+            std::move_backward(
+                to->values, to->values + to->len, to->values + to->len + 1);
+            to->keys[0] = std::move(from->keys[from->len - 1]);
+            to->values[0] = std::move(from->values[from->len - 1]);
+            parent->keys[i - 1] = from->keys[from->len - 2];
+        } else {
+            auto *from = static_cast<Inner *>(left);
+            auto *to = static_cast<Inner *>(node);
+            std::copy_backward(to->children,
+                               to->children + to->len + 1,
+                               to->children + to->len + 2);
+            to->keys[0] = std::move(parent->keys[i - 1]);
+            to->children[0] = from->children[from->len];
+            parent->keys[i - 1] = std::move(from->keys[from->len - 1]);
+        }
+
+        left->shrink(left->len - 1);
+        node->len++;
+    }
+
+    /**
+     * @brief Moves the first entry of `children[i + 1]` to `children[i]`.
+     */
+    static void borrow_right(Inner *parent, usize i, usize level)
+    {
+        Node *node = parent->children[i];
+        Node *right = parent->children[i + 1];
+
+        if (level == 0) {
+            auto *to = static_cast<Leaf *>(node);
+            auto *from = static_cast<Leaf *>(right);
+            to->keys[to->len] = std::move(from->keys[0]);
+            to->values[to->len] = std::move(from->values[0]);
+            parent->keys[i] = to->keys[to->len];
+            std::move(from->values + 1,
+                      from->values + from->len,
+                      from->values);
+        } else {
+            auto *to = static_cast<Inner *>(node);
+            auto *from = static_cast<Inner *>(right);
+            to->keys[to->len] = std::move(parent->keys[i]);
+            to->children[to->len + 1] = from->children[0];
+            parent->keys[i] = std::move(from->keys[0]);
+            std::copy(from->children + 1,
+                      from->children + from->len + 1,
+                      from->children);
+        }
+
+        std::move(right->keys + 1, right->keys + right->len, right->keys);
+        node->len++;
+        right->shrink(right->len - 1);
+    }
+
+    /**
+     * @brief Moves everything in `children[i + 1]` to `children[i]`, and
+     * drops it.
+     */
+    void merge(Inner *parent, usize i, usize level)
+    {
+        Node *left = parent->children[i];
+        Node *right = parent->children[i + 1];
+
+        if (level == 0) {
+            auto *to = static_cast<Leaf *>(left);
+            auto *from = static_cast<Leaf *>(right);
+            std::move(from->keys, from->keys + from->len, to->keys + to->len);
+            std::move(
+                from->values, from->values + from->len, to->values + to->len);
+            to->len += from->len;
+
+            to->next = from->next;
+            if (from->next != nullptr)
+                from->next->prev = to;
+            else
+                this->tail = to;
+
+            delete from;
+        } else {
+            auto *to = static_cast<Inner *>(left);
+            auto *from = static_cast<Inner *>(right);
+            to->keys[to->len] = std::move(parent->keys[i]);
+            std::move(
+                from->keys, from->keys + from->len, to->keys + to->len + 1);
+            std::copy(from->children,
+                      from->children + from->len + 1,
+                      to->children + to->len + 1);
+            to->len += from->len + 1;
+
+            delete from;
+        }
+
+        // `left` now holds keys up to the bound of `right`.
+        std::move(parent->keys + i + 1,
+                  parent->keys + parent->len,
+                  parent->keys + i);
+        std::copy(parent->children + i + 2,
+                  parent->children + parent->len + 1,
+                  parent->children + i + 1);
+        parent->shrink(parent->len - 1);
+    }
+
+    /**
+     * @brief Removes from the subtree under `node`, `level`s above the leaves,
+     * refilling children left with fewer than `MIN` keys.
+     */
+    Maybe<V> remove_from(Node *node, usize level, K const &key)
+    {
+        usize i = search(node, key);
+
+        if (level == 0) {
+            auto *leaf = static_cast<Leaf *>(node);
+            if (i == leaf->len || key < leaf->keys[i])
+                return None();
+
+            Maybe<V> value = Some(std::move(leaf->values[i]));
+            std::move(
+                leaf->keys + i + 1, leaf->keys + leaf->len, leaf->keys + i);
+            std::move(leaf->values + i + 1,
+                      leaf->values + leaf->len,
+                      leaf->values + i);
+            leaf->shrink(leaf->len - 1);
+            this->count--;
+
+            return value;
+        }
+
+        auto    *inner = static_cast<Inner *>(node);
+        Maybe<V> value = this->remove_from(inner->children[i], level - 1, key);
+        if (value.is_none() || inner->children[i]->len >= MIN)
+            return value;
+
+        if (i > 0 && inner->children[i - 1]->len > MIN)
+            borrow_left(inner, i, level - 1);
+        else if (i < inner->len && inner->children[i + 1]->len > MIN)
+            borrow_right(inner, i, level - 1);
+        else
+            this->merge(inner, i > 0 ? i - 1 : i, level - 1);
+
+        return value;
+    }
+
+  public:
+    BTreeMap() = default;
+
+    BTreeMap(BTreeMap const &) = delete;
+    BTreeMap &operator=(BTreeMap const &) = delete;
+
+    BTreeMap(BTreeMap &&other) noexcept
+        : root(std::exchange(other.root, nullptr))
+        , height(std::exchange(other.height, 0))
+        , count(std::exchange(other.count, 0))
+        , head(std::exchange(other.head, nullptr))
+        , tail(std::exchange(other.tail, nullptr))
+    {
+    }
+
+    BTreeMap &operator=(BTreeMap &&other) noexcept
+    {
+        if (this != &other) {
+            this->clear();
+            this->root = std::exchange(other.root, nullptr);
+            this->height = std::exchange(other.height, 0);
+            this->count = std::exchange(other.count, 0);
+            this->head = std::exchange(other.head, nullptr);
+            this->tail = std::exchange(other.tail, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~BTreeMap() { this->clear(); }
+
+    /**
+     * @brief Builds a map from the entries in [first, last) (forward
+     * iterators over pairs of key and value, e.g. of a `std::vector` of
+     * `std::pair`), bottom-up: leaves are filled up and linked in one pass,
+     * then each level of inner nodes is built over the one below.
+     *
+     * @exception std::invalid_argument Thrown if keys are not strictly
+     * increasing.
+     */
+    template<typename I>
+    static BTreeMap from_sorted(I first, I last)
+    {
+        if (std::adjacent_find(first, last, [](auto const &a, auto const &b) {
+                return !(a.first < b.first);
+            }) != last)
+            throw std::invalid_argument(
+                "BTreeMap::from_sorted needs strictly increasing keys");
+
+        BTreeMap map;
+        usize    len = static_cast<usize>(std::distance(first, last));
+        if (len == 0)
+            return map;
+
+        // Spread evenly, so that no node but the root is below `MIN`.
+        std::vector<Node *>    nodes((len + CAPACITY - 1) / CAPACITY);
+        std::vector<K const *> maxes(nodes.size());
+        std::vector<Inner *>   inners;
+
+        try {
+            for (usize n = 0; n < nodes.size(); n++) {
+                auto *leaf = new Leaf();
+                leaf->prev = map.tail;
+                if (map.tail != nullptr)
+                    map.tail->next = leaf;
+                else
+                    map.head = leaf;
+                map.tail = leaf;
+
+                usize size = len / nodes.size() + (n < len % nodes.size());
+                for (; leaf->len < size; ++first, leaf->len++) {
+                    auto &&entry = *first;
+                    leaf->keys[leaf->len] = entry.first;
+                    leaf->values[leaf->len] =
+                        std::forward<decltype(entry)>(entry).second;
+                }
+
+                nodes[n] = leaf;
+                maxes[n] = &leaf->keys[leaf->len - 1];
+            }
+
+            while (nodes.size() > 1) {
+                usize parents = (nodes.size() + CAPACITY) / (CAPACITY + 1);
+                usize child = 0;
+
+                for (usize n = 0; n < parents; n++) {
+                    auto *inner = new Inner();
+                    inners.push_back(inner);
+
+                    usize size =
+                        nodes.size() / parents + (n < nodes.size() % parents);
+                    for (usize c = 0; c < size; c++, child++) {
+                        inner->children[c] = nodes[child];
+                        if (c + 1 < size)
+                            inner->keys[c] = *maxes[child];
+                    }
+                    inner->len = size - 1;
+
+                    nodes[n] = inner;
+                    maxes[n] = maxes[child - 1];
+                }
+
+                nodes.resize(parents);
+                maxes.resize(parents);
+                map.height++;
+            }
+        } catch (...) {
+            for (Leaf *leaf = map.head; leaf != nullptr;)
+                delete std::exchange(leaf, leaf->next);
+            for (Inner *inner : inners)
+                delete inner;
+
+            map.head = map.tail = nullptr;
+            throw;
+        }
+
+        map.root = nodes[0];
+        map.count = len;
+        return map;
+    }
+
+    inline usize len() const { return this->count; }
+    inline bool  is_empty() const { return this->count == 0; }
+
+    /**
+     * @brief Gets a reference to the value of `key`, or `None` if absent.
+     */
+    Maybe<V &> get(K const &key)
+    {
+        if (this->root == nullptr)
+            return None();
+
+        auto [leaf, index] = this->find(key);
+        if (index == leaf->len || key < leaf->keys[index])
+            return None();
+
+        return Some<V &>(leaf->values[index]);
+    }
+
+    Maybe<V const &> get(K const &key) const
+    {
+        if (this->root == nullptr)
+            return None();
+
+        auto [leaf, index] = this->find(key);
+        if (index == leaf->len || key < leaf->keys[index])
+            return None();
+
+        return Some<V const &>(leaf->values[index]);
+    }
+
+    inline bool contains(K const &key) const
+    {
+        return this->get(key).is_some();
+    }
+
+    /**
+     * @brief Sets the value of `key`.
+     *
+     * @return The value it replaced, or `None` if `key` was absent.
+     */
+    Maybe<V> insert(K key, V value)
+    {
+        if (this->root == nullptr) {
+            this->head = this->tail = new Leaf();
+            this->root = this->head;
+        }
+
+        Maybe<V> old;
+        K        separator{};
+        Node    *right = this->insert_into(
+            this->root, this->height, key, value, old, separator);
+
+        if (right != nullptr) {
+            auto *top = new Inner();
+            top->keys[0] = std::move(separator);
+            top->children[0] = this->root;
+            top->children[1] = right;
+            top->len = 1;
+
+            this->root = top;
+            this->height++;
+        }
+
+        return old;
+    }
+
+    /**
+     * @brief Removes `key`.
+     *
+     * @return Its value, or `None` if it was absent.
+     */
+    Maybe<V> remove(K const &key)
+    {
+        if (this->root == nullptr)
+            return None();
+
+        Maybe<V> value = this->remove_from(this->root, this->height, key);
+
+        if (this->root->len == 0) {
+            if (this->height == 0) {
+                delete static_cast<Leaf *>(this->root);
+                this->root = nullptr;
+                this->head = this->tail = nullptr;
+            } else {
+                auto *top = static_cast<Inner *>(this->root);
+                this->root = top->children[0];
+                this->height--;
+                delete top;
+            }
+        }
+
+        return value;
+    }
+
+    /**
+     * @brief Removes every entry.
+     */
+    void clear()
+    {
+        if (this->root != nullptr)
+            destroy(this->root, this->height);
+
+        this->root = nullptr;
+        this->height = 0;
+        this->count = 0;
+        this->head = this->tail = nullptr;
+    }
+
+    /**
+     * @brief The entry with the smallest key, or `None` if empty.
+     */
+    Maybe<Entry> first()
+    {
+        if (this->head == nullptr)
+            return None();
+
+        return Some(Entry(this->head->keys[0], this->head->values[0]));
+    }
+
+    Maybe<ConstEntry> first() const
+    {
+        if (this->head == nullptr)
+            return None();
+
+        return Some(ConstEntry(this->head->keys[0], this->head->values[0]));
+    }
+
+    /**
+     * @brief The entry with the largest key, or `None` if empty.
+     */
+    Maybe<Entry> last()
+    {
+        if (this->tail == nullptr)
+            return None();
+
+        usize i = this->tail->len - 1;
+        return Some(Entry(this->tail->keys[i], this->tail->values[i]));
+    }
+
+    Maybe<ConstEntry> last() const
+    {
+        if (this->tail == nullptr)
+            return None();
+
+        usize i = this->tail->len - 1;
+        return Some(ConstEntry(this->tail->keys[i], this->tail->values[i]));
+    }
+
+    /**
+     * @brief Iterates over every entry in key order.
+     */
+    inline BTreeIter<K, V> iter()
+    {
+        return BTreeIter<K, V>(this->head, 0, nullptr, 0);
+    }
+
+    inline BTreeIter<K, V const> iter() const
+    {
+        return BTreeIter<K, V const>(this->head, 0, nullptr, 0);
+    }
+
+    /**
+     * @brief Iterates in key order over the entries with keys in [from, to).
+     */
+    BTreeIter<K, V> range(K const &from, K const &to)
+    {
+        if (!(from < to))
+            return BTreeIter<K, V>(nullptr, 0, nullptr, 0);
+
+        auto [first, first_index] = this->lower_bound(from);
+        auto [last, last_index] = this->lower_bound(to);
+        return BTreeIter<K, V>(first, first_index, last, last_index);
+    }
+
+    BTreeIter<K, V const> range(K const &from, K const &to) const
+    {
+        if (!(from < to))
+            return BTreeIter<K, V const>(nullptr, 0, nullptr, 0);
+
+        auto [first, first_index] = this->lower_bound(from);
+        auto [last, last_index] = this->lower_bound(to);
+        return BTreeIter<K, V const>(first, first_index, last, last_index);
+    }
+};
+}
@@ -0,0 +1,73 @@
+/**
+ * @file cache_padded.hpp
+ * @author Jesús Blanco
+ * @brief Padding values to their own cache line (`CachePadded<T>`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "types.hpp"
+#include <new>
+#include <utility>
+
+namespace cy {
+/**
+ * @brief The distance that keeps two objects from sharing a cache line. Define
+ * `CY_CACHE_LINE_SIZE` to override it.
+ */
+#if defined(CY_CACHE_LINE_SIZE)
+constexpr usize CACHE_LINE_SIZE = CY_CACHE_LINE_SIZE;
+#elif defined(__cpp_lib_hardware_interference_size)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+constexpr usize CACHE_LINE_SIZE = std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#elif defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) ||        \
+    defined(__powerpc64__)
+// These prefetch cache lines in pairs.
+constexpr usize CACHE_LINE_SIZE = 128;
+#else
+constexpr usize CACHE_LINE_SIZE = 64;
+#endif
+
+/**
+ * @brief A `T` aligned and padded to `CACHE_LINE_SIZE`, so it never shares a
+ * cache line with other data, avoiding false sharing between threads.
+ */
+template<typename T>
+class alignas(CACHE_LINE_SIZE) CachePadded
+{
+  private:
+    T value;
+
+  public:
+    template<typename... Args>
+    explicit constexpr CachePadded(Args &&...args)
+        : value(std::forward<Args>(args)...)
+    {
+    }
+
+    /**
+     * @brief Gets a const reference to `T` (`T const&`).
+     */
+    inline constexpr T const &get() const { return this->value; }
+    /**
+     * @brief Gets a reference to `T` (`T&`).
+     */
+    inline constexpr T &get() { return this->value; }
+
+    inline T const &operator*() const { return this->value; }
+    inline T       &operator*() { return this->value; }
+    inline T const *operator->() const { return &this->value; }
+    inline T       *operator->() { return &this->value; }
+};
+}
@@ -0,0 +1,182 @@
+/**
+ * @file chase_lev_deque.hpp
+ * @author Jesús Blanco
+ * @brief A lock-free work-stealing deque (`ChaseLevDeque<T>`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "cache_padded.hpp"
+#include "safety.hpp"
+#include "types.hpp"
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace cy {
+/**
+ * @brief The Chase-Lev deque (as formalized for C11 atomics by Lê et al.):
+ * one owner thread pushes and pops at the bottom, like a stack, while any
+ * number of thieves steal from the top. Only the last item and steals need a
+ * CAS; pushes and pops are otherwise plain loads and stores.
+ *
+ * The buffer grows as needed and never shrinks. Replaced buffers are kept
+ * until the deque is destroyed, since a thief may still be reading them.
+ *
+ * @attention `T` must be trivially copyable (e.g. a pointer to a job).
+ */
+template<typename T>
+class ChaseLevDeque
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "ChaseLevDeque needs a trivially copyable type.");
+
+  private:
+    struct Buffer
+    {
+        usize                             mask;
+        std::unique_ptr<std::atomic<T>[]> items;
+
+        explicit Buffer(usize capacity)
+            : mask(capacity - 1)
+            , items(new std::atomic<T>[capacity])
+        {
+        }
+
+        inline T load(int64 index) const
+        {
+            return this->items[static_cast<usize>(index) & this->mask].load(
+                std::memory_order_relaxed);
+        }
+
+        inline void store(int64 index, T value)
+        {
+            this->items[static_cast<usize>(index) & this->mask].store(
+                value, std::memory_order_relaxed);
+        }
+    };
+
+    CachePadded<std::atomic<int64>>      top;
+    CachePadded<std::atomic<int64>>      bottom;
+    std::atomic<Buffer *>                buffer;
+    std::vector<std::unique_ptr<Buffer>> buffers;
+
+    Buffer *grow(Buffer *old, int64 b, int64 t)
+    {
+        auto bigger = std::make_unique<Buffer>((old->mask + 1) * 2);
+        for (int64 i = t; i < b; i++)
+            bigger->store(i, old->load(i));
+
+        Buffer *raw = bigger.get();
+        this->buffers.push_back(std::move(bigger));
+        this->buffer.store(raw, std::memory_order_release);
+        return raw;
+    }
+
+  public:
+    /**
+     * @brief Creates an empty deque with room for `capacity` items (rounded up
+     * to a power of two) before growing.
+     */
+    explicit ChaseLevDeque(usize capacity = 64)
+        : top(0)
+        , bottom(0)
+    {
+        usize rounded = 1;
+        while (rounded < capacity)
+            rounded *= 2;
+
+        this->buffers.push_back(std::make_unique<Buffer>(rounded));
+        this->buffer.store(this->buffers.back().get(),
+                           std::memory_order_relaxed);
+    }
+
+    ChaseLevDeque(ChaseLevDeque const &) = delete;
+    ChaseLevDeque &operator=(ChaseLevDeque const &) = delete;
+
+    /**
+     * @brief Pushes `value` at the bottom. Owner only.
+     */
+    void push(T value)
+    {
+        int64   b = this->bottom->load(std::memory_order_relaxed);
+        int64   t = this->top->load(std::memory_order_acquire);
+        Buffer *a = this->buffer.load(std::memory_order_relaxed);
+
+        if (b - t > static_cast<int64>(a->mask))
+            a = this->grow(a, b, t);
+
+        a->store(b, value);
+        this->bottom->store(b + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Pops the newest item from the bottom. Owner only.
+     */
+    Maybe<T> pop()
+    {
+        int64   b = this->bottom->load(std::memory_order_relaxed) - 1;
+        Buffer *a = this->buffer.load(std::memory_order_relaxed);
+        this->bottom->store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64 t = this->top->load(std::memory_order_relaxed);
+
+        if (t > b) {
+            this->bottom->store(b + 1, std::memory_order_relaxed);
+            return None();
+        }
+
+        T value = a->load(b);
+        if (t == b) {
+            // Last item: race the thieves for it.
+            bool won = this->top->compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            this->bottom->store(b + 1, std::memory_order_relaxed);
+            if (!won)
+                return None();
+        }
+
+        return Some(value);
+    }
+
+    /**
+     * @brief Steals the oldest item from the top. Any thread. `None` when the
+     * deque is empty or another thread won the race for the item.
+     */
+    Maybe<T> steal()
+    {
+        int64 t = this->top->load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64 b = this->bottom->load(std::memory_order_acquire);
+
+        if (t >= b)
+            return None();
+
+        Buffer *a = this->buffer.load(std::memory_order_acquire);
+        T       value = a->load(t);
+        if (!this->top->compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return None();
+
+        return Some(value);
+    }
+
+    /**
+     * @brief Number of items, which may be stale by the time it returns.
+     */
+    inline usize len() const
+    {
+        int64 b = this->bottom->load(std::memory_order_relaxed);
+        int64 t = this->top->load(std::memory_order_relaxed);
+        return b > t ? static_cast<usize>(b - t) : 0;
+    }
+
+    inline bool is_empty() const { return this->len() == 0; }
+};
+}
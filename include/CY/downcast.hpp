@@ -0,0 +1,208 @@
+/**
+ * @file downcast.hpp
+ * @author Jesús Blanco
+ * @brief Checked downcasts through a type id stored in the base (`downcast`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "hash.hpp"
+#include "safety.hpp"
+#include "types.hpp"
+#include <type_traits>
+#include <utility>
+
+namespace cy {
+class Downcastable;
+
+namespace detail {
+/**
+ * @brief What `Downcastable` stores: the id of the most derived registered
+ * class and the type info of its nearest registered ancestor.
+ */
+struct TypeInfo
+{
+    uint64          id;
+    TypeInfo const *parent;
+};
+
+/**
+ * @brief A hash of `T`'s spelled out name. Unlike the address of a static,
+ * it is the same in every shared library that sees `T`.
+ */
+template<typename T>
+constexpr uint64 type_id()
+{
+#if defined(_MSC_VER)
+    return fnv1a(__FUNCSIG__);
+#else
+    return fnv1a(__PRETTY_FUNCTION__);
+#endif
+}
+
+template<typename T>
+struct TypeOf
+{
+    static constexpr TypeInfo info{
+        type_id<T>(), &TypeOf<typename T::DowncastParent::DowncastSelf>::info
+    };
+};
+
+template<>
+struct TypeOf<Downcastable>
+{
+    static constexpr TypeInfo info{ type_id<Downcastable>(), nullptr };
+};
+
+/**
+ * @brief `T` is registered if it derives from `Subclass<T, ...>`.
+ */
+template<typename T>
+constexpr bool is_registered = std::is_same_v<typename T::DowncastSelf, T>;
+
+/**
+ * @brief `Derived`, const if `Base` is.
+ */
+template<typename Derived, typename Base>
+using Downcast =
+    std::conditional_t<std::is_const_v<Base>, Derived const, Derived>;
+}
+
+/**
+ * @brief Root of a hierarchy that supports `downcast`. Each object stores the
+ * type info of its most derived registered class, set by the constructors of
+ * `Subclass`, the way a vtable pointer is.
+ */
+class Downcastable
+{
+  private:
+    detail::TypeInfo const *downcast_info;
+
+    template<typename Self, typename Parent>
+    friend class Subclass;
+
+    template<typename Derived, typename Base>
+    friend Maybe<detail::Downcast<Derived, Base> &> downcast(Base &base);
+
+    /**
+     * @brief Whether this object's class is `target` or derives from it. One
+     * compare for the exact class, and one more per level in between.
+     */
+    inline bool is_a(uint64 target) const
+    {
+        for (auto info = this->downcast_info; info != nullptr;
+             info = info->parent) {
+            if (info->id == target)
+                return true;
+        }
+
+        return false;
+    }
+
+  public:
+    using DowncastSelf = Downcastable;
+
+    Downcastable() noexcept
+        : downcast_info(&detail::TypeOf<Downcastable>::info)
+    {
+    }
+
+    // The type info belongs to the object being built, not the one it is
+    // copied from (which may be of a more derived class).
+    Downcastable(Downcastable const &) noexcept
+        : Downcastable()
+    {
+    }
+
+    Downcastable &operator=(Downcastable const &) noexcept { return *this; }
+};
+
+/**
+ * @brief Registers `Self` as a subclass of `Parent` for `downcast`. Derive
+ * from it instead of from `Parent`:
+ *
+ * @code
+ * class Ping : public cy::Subclass<Ping, Message>
+ * {
+ *   public:
+ *     Ping(usize seq)
+ *         : Subclass(seq) // Arguments go to Message.
+ *     {
+ *     }
+ * };
+ * @endcode
+ */
+template<typename Self, typename Parent>
+class Subclass : public Parent
+{
+    static_assert(std::is_base_of_v<Downcastable, Parent>,
+                  "Subclass needs a parent that derives from Downcastable.");
+
+  public:
+    using DowncastSelf = Self;
+    using DowncastParent = Parent;
+
+    template<typename... Args>
+    Subclass(Args &&...args)
+        : Parent(std::forward<Args>(args)...)
+    {
+        this->downcast_info = &detail::TypeOf<Self>::info;
+    }
+
+    Subclass(Subclass const &other)
+        : Parent(other)
+    {
+        this->downcast_info = &detail::TypeOf<Self>::info;
+    }
+
+    Subclass(Subclass &&other) noexcept(
+        std::is_nothrow_move_constructible_v<Parent>)
+        : Parent(std::move(other))
+    {
+        this->downcast_info = &detail::TypeOf<Self>::info;
+    }
+
+    Subclass &operator=(Subclass const &) = default;
+    Subclass &operator=(Subclass &&) = default;
+};
+
+/**
+ * @brief `base` as a `Derived&`, or `None` if it is not one. Registered
+ * classes (see `Subclass`) are checked with integer compares; any other
+ * `Derived` falls back to `dynamic_cast`, which needs a polymorphic `Base`.
+ */
+template<typename Derived, typename Base>
+Maybe<detail::Downcast<Derived, Base> &> downcast(Base &base)
+{
+    using Target = detail::Downcast<Derived, Base>;
+
+    static_assert(std::is_base_of_v<Downcastable, Base>,
+                  "downcast needs a Base that derives from Downcastable.");
+    static_assert(std::is_base_of_v<std::remove_const_t<Base>, Derived>,
+                  "downcast needs a Derived that derives from Base.");
+
+    if constexpr (detail::is_registered<Derived>) {
+        constexpr uint64    target = detail::type_id<Derived>();
+        Downcastable const &root = base;
+        if (!root.is_a(target))
+            return None();
+
+        return Some<Target &>(static_cast<Target &>(base));
+    } else {
+        static_assert(std::is_polymorphic_v<Base>,
+                      "downcast to an unregistered class needs a polymorphic "
+                      "Base (it uses dynamic_cast).");
+
+        Target *derived = dynamic_cast<Target *>(&base);
+        if (derived == nullptr)
+            return None();
+
+        return Some<Target &>(*derived);
+    }
+}
+}
@@ -0,0 +1,474 @@
+/**
+ * @file epoch.hpp
+ * @author Jesús Blanco
+ * @brief Epoch-based reclamation of memory shared between threads, with
+ * hazard pointers for long-lived readers (`Collector`, `EpochGuard`,
+ * `HazardGuard`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "cache_padded.hpp"
+#include "safety.hpp"
+#include "types.hpp"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cy {
+class Collector;
+
+namespace detail {
+/**
+ * @brief Memory retired in `epoch`, freed by `drop(ptr)`.
+ */
+struct Retired
+{
+    void  *ptr;
+    void (*drop)(void *);
+    uint64 epoch;
+};
+
+/**
+ * @brief A thread taking part in epoch-based reclamation. Records are never
+ * freed; one whose thread exited is reused by the next thread to come.
+ */
+struct EpochRecord
+{
+    /// @brief `epoch * 2 + 1` while pinned, 0 otherwise.
+    std::atomic<uint64> state{ 0 };
+    std::atomic<bool>   active{ true };
+    EpochRecord        *next = nullptr;
+
+    // Only touched by the owner thread.
+    /// @brief Guards alive on the owner thread (pins nest).
+    usize pins = 0;
+    /// @brief What the thread retired and was not freed yet.
+    std::vector<Retired> bag;
+    /// @brief Size of `bag` after it was last gone over.
+    usize flushed = 0;
+    /// @brief Global epoch when `bag` was last gone over.
+    uint64 flushed_epoch = 0;
+};
+
+/**
+ * @brief A published hazard pointer: what it points to is not freed.
+ */
+struct HazardSlot
+{
+    std::atomic<void const *> ptr{ nullptr };
+    std::atomic<bool>         active{ true };
+    HazardSlot               *next = nullptr;
+};
+
+/**
+ * @brief Takes an inactive node of a list of never-freed nodes, or pushes a
+ * new one.
+ */
+template<typename Node>
+Node *claim(std::atomic<Node *> &head)
+{
+    auto *node = head.load(std::memory_order_acquire);
+    for (; node != nullptr; node = node->next) {
+        bool active = node->active.load(std::memory_order_relaxed);
+        if (!active && node->active.compare_exchange_strong(
+                           active, true, std::memory_order_acquire))
+            return node;
+    }
+
+    node = new Node();
+    node->next = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(
+        node->next, node, std::memory_order_release)) {
+    }
+
+    return node;
+}
+}
+
+/**
+ * @brief Keeps the `Collector` from freeing what the thread may be reading.
+ * Created by `Collector::pin()`; unpins when the last guard of the thread is
+ * dropped.
+ */
+class EpochGuard
+{
+  private:
+    detail::EpochRecord *record;
+
+    explicit EpochGuard(detail::EpochRecord *record)
+        : record(record)
+    {
+    }
+
+    friend class Collector;
+
+  public:
+    EpochGuard(EpochGuard const &) = delete;
+    EpochGuard &operator=(EpochGuard const &) = delete;
+
+    EpochGuard(EpochGuard &&other) noexcept
+        : record(std::exchange(other.record, nullptr))
+    {
+    }
+
+    ~EpochGuard()
+    {
+        if (this->record != nullptr && --this->record->pins == 0)
+            this->record->state.store(0, std::memory_order_release);
+    }
+};
+
+/**
+ * @brief A pointer the `Collector` won't free while the guard lives, however
+ * many epochs go by. Created by `Collector::protect`.
+ */
+template<typename T>
+class HazardGuard
+{
+  private:
+    detail::HazardSlot *slot;
+    T                  *value;
+
+    HazardGuard(detail::HazardSlot *slot, T *value)
+        : slot(slot)
+        , value(value)
+    {
+    }
+
+    friend class Collector;
+
+  public:
+    HazardGuard(HazardGuard const &) = delete;
+    HazardGuard &operator=(HazardGuard const &) = delete;
+
+    HazardGuard(HazardGuard &&other) noexcept
+        : slot(std::exchange(other.slot, nullptr))
+        , value(other.value)
+    {
+    }
+
+    ~HazardGuard()
+    {
+        if (this->slot == nullptr)
+            return;
+
+        this->slot->ptr.store(nullptr, std::memory_order_release);
+        this->slot->active.store(false, std::memory_order_release);
+    }
+
+    inline T *get() const { return this->value; }
+    inline T &operator*() const { return *this->value; }
+    inline T *operator->() const { return this->value; }
+};
+
+/**
+ * @brief Epoch-based reclamation: memory unlinked from a shared structure is
+ * `retire`d rather than freed, and only freed once every thread that could
+ * have been reading it has moved on.
+ *
+ * Readers `pin()` the current global epoch before reading shared pointers.
+ * The epoch only advances once every pinned thread has seen the current one,
+ * so memory retired in epoch `e` is unreachable by anyone once the epoch gets
+ * to `e + 2`. Pinning is a store to a slot of the thread's own, plus a fence:
+ * no read-modify-write of a shared cache line, so readers don't slow each
+ * other down.
+ *
+ * Each thread keeps what it retires in a bag of its own, without locking, and
+ * goes over it every `RETIRE_BATCH` retires. What is left when a thread exits
+ * goes to a shared list, which those same passes go over too when no other
+ * thread is at it, and `collect()` always does.
+ *
+ * A reader pinned for long holds back every thread's garbage. One holding on
+ * to a single object should `protect` it with a hazard pointer instead: only
+ * that object is kept, whatever the epoch.
+ */
+class Collector
+{
+  public:
+    /**
+     * @brief Retires between two attempts to free a thread's bag.
+     */
+    static constexpr usize RETIRE_BATCH = 64;
+
+  private:
+    CachePadded<std::atomic<uint64>>   epoch{ 0 };
+    std::atomic<detail::EpochRecord *> records{ nullptr };
+    std::atomic<detail::HazardSlot *>  hazards{ nullptr };
+    std::mutex                         lock;
+    /// @brief Left unfreed by threads that exited.
+    std::vector<detail::Retired> orphans;
+
+    Collector() = default;
+
+    /**
+     * @brief The record of the calling thread, given back when it exits.
+     */
+    detail::EpochRecord *local()
+    {
+        struct Handle
+        {
+            Collector           *collector;
+            detail::EpochRecord *record;
+
+            ~Handle()
+            {
+                auto &bag = this->record->bag;
+                if (!bag.empty()) {
+                    std::lock_guard<std::mutex> guard(this->collector->lock);
+                    this->collector->orphans.insert(
+                        this->collector->orphans.end(), bag.begin(), bag.end());
+                    bag.clear();
+                }
+
+                this->record->flushed = 0;
+                this->record->flushed_epoch = 0;
+                this->record->active.store(false, std::memory_order_release);
+            }
+        };
+
+        thread_local Handle handle{ this, detail::claim(this->records) };
+        return handle.record;
+    }
+
+    /**
+     * @brief Moves the epoch on if every pinned thread has seen the current
+     * one.
+     */
+    bool try_advance()
+    {
+        uint64 current = this->epoch->load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        auto *record = this->records.load(std::memory_order_acquire);
+        for (; record != nullptr; record = record->next) {
+            // Acquire: what the thread read before unpinning happens before
+            // anything freed after this.
+            uint64 state = record->state.load(std::memory_order_acquire);
+            if (state % 2 != 0 && state / 2 != current)
+                return false;
+        }
+
+        return this->epoch->compare_exchange_strong(
+            current, current + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Every published hazard pointer, sorted.
+     */
+    std::vector<void const *> protected_pointers()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        std::vector<void const *> out;
+        auto *slot = this->hazards.load(std::memory_order_acquire);
+        for (; slot != nullptr; slot = slot->next) {
+            void const *ptr = slot->ptr.load(std::memory_order_acquire);
+            if (ptr != nullptr)
+                out.push_back(ptr);
+        }
+
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    /**
+     * @brief Frees what in `bag` no thread can be reading, after moving the
+     * epoch on as far as pinned threads allow (twice at most).
+     */
+    usize reclaim(std::vector<detail::Retired> &bag)
+    {
+        if (this->try_advance())
+            this->try_advance();
+
+        uint64 current = this->epoch->load(std::memory_order_acquire);
+        auto   hazards = this->protected_pointers();
+
+        auto split = std::partition(
+            bag.begin(), bag.end(), [&](detail::Retired const &retired) {
+                return retired.epoch + 2 > current ||
+                       std::binary_search(
+                           hazards.begin(), hazards.end(), retired.ptr);
+            });
+
+        // Out of the bag first: dropping may retire more.
+        std::vector<detail::Retired> ready(split, bag.end());
+        bag.erase(split, bag.end());
+
+        for (auto const &retired : ready)
+            retired.drop(retired.ptr);
+
+        return ready.size();
+    }
+
+    /**
+     * @brief Frees what threads that exited left and no thread can be reading
+     * anymore. Unless `wait`, gives up if another thread holds the list.
+     */
+    usize reclaim_orphans(bool wait)
+    {
+        std::vector<detail::Retired> orphans;
+        {
+            std::unique_lock<std::mutex> guard(this->lock, std::defer_lock);
+            if (wait)
+                guard.lock();
+            else if (!guard.try_lock())
+                return 0;
+
+            orphans.swap(this->orphans);
+        }
+
+        if (orphans.empty())
+            return 0;
+
+        usize freed = this->reclaim(orphans);
+
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->orphans.insert(
+            this->orphans.end(), orphans.begin(), orphans.end());
+        return freed;
+    }
+
+  public:
+    Collector(Collector const &) = delete;
+    Collector &operator=(Collector const &) = delete;
+
+    /**
+     * @brief The process-wide collector. It is never destroyed, so threads
+     * can unpin and retire while the process exits.
+     */
+    static Collector &global()
+    {
+        static Collector *collector = new Collector();
+        return *collector;
+    }
+
+    /**
+     * @brief Pins the calling thread to the current epoch until the guard is
+     * dropped: nothing retired from now on is freed meanwhile.
+     */
+    EpochGuard pin()
+    {
+        detail::EpochRecord *record = this->local();
+        if (record->pins++ == 0) {
+            uint64 current = this->epoch->load(std::memory_order_relaxed);
+            record->state.store(current * 2 + 1, std::memory_order_relaxed);
+            // The pin must be visible before any shared pointer is read.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        return EpochGuard(record);
+    }
+
+    /**
+     * @brief Protects what `source` points to with a hazard pointer, or
+     * returns `None` if it is null. Unlike a pin, it doesn't hold back the
+     * epoch, so it suits readers holding on to one object for long.
+     */
+    template<typename T>
+    Maybe<HazardGuard<T>> protect(std::atomic<T *> const &source)
+    {
+        detail::HazardSlot *slot = detail::claim(this->hazards);
+
+        T *ptr = source.load(std::memory_order_relaxed);
+        while (true) {
+            slot->ptr.store(ptr, std::memory_order_relaxed);
+            // The hazard must be visible before `source` is checked again:
+            // if it still holds `ptr`, `ptr` was not retired before.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            T *again = source.load(std::memory_order_acquire);
+            if (again == ptr)
+                break;
+
+            ptr = again;
+        }
+
+        if (ptr == nullptr) {
+            slot->active.store(false, std::memory_order_release);
+            return None();
+        }
+
+        return Some(HazardGuard<T>(slot, ptr));
+    }
+
+    /**
+     * @brief Calls `drop(ptr)` once no thread can be reading `ptr`, which
+     * must already be unreachable for threads that pin from now on.
+     */
+    void retire(void *ptr, void (*drop)(void *))
+    {
+        detail::EpochRecord *record = this->local();
+        // The unlinking of `ptr` must be ordered before reading the epoch, as
+        // pins are ordered before reading shared pointers: otherwise a
+        // reader could pin a later epoch and still find `ptr`.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        record->bag.push_back(detail::Retired{
+            ptr, drop, this->epoch->load(std::memory_order_acquire) });
+
+        // What is left after going over the bag is held back by readers, so
+        // wait for a whole batch more before going over it again, and for the
+        // epoch to move on: nothing else gets freed until it does.
+        if (record->bag.size() < record->flushed + RETIRE_BATCH)
+            return;
+
+        if (this->try_advance() ||
+            this->current_epoch() != record->flushed_epoch) {
+            this->reclaim(record->bag);
+            this->reclaim_orphans(false);
+            record->flushed_epoch = this->current_epoch();
+        }
+
+        record->flushed = record->bag.size();
+    }
+
+    /**
+     * @brief Deletes `ptr` once no thread can be reading it.
+     */
+    template<typename T>
+    void retire(T *ptr)
+    {
+        this->retire(const_cast<void *>(static_cast<void const *>(ptr)),
+                     [](void *p) { delete static_cast<T *>(p); });
+    }
+
+    /**
+     * @brief Frees what the calling thread, and threads that exited, retired
+     * and no thread can be reading anymore.
+     *
+     * @return The number of retired pointers freed.
+     */
+    usize collect()
+    {
+        detail::EpochRecord *record = this->local();
+        usize                freed = this->reclaim(record->bag);
+        record->flushed = record->bag.size();
+
+        return freed + this->reclaim_orphans(true);
+    }
+
+    /**
+     * @brief Number of pointers retired by the calling thread, or by threads
+     * that exited, and not freed yet.
+     */
+    usize pending()
+    {
+        usize local = this->local()->bag.size();
+
+        std::lock_guard<std::mutex> guard(this->lock);
+        return local + this->orphans.size();
+    }
+
+    inline uint64 current_epoch() const
+    {
+        return this->epoch->load(std::memory_order_relaxed);
+    }
+};
+}
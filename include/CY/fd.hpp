@@ -0,0 +1,224 @@
+/**
+ * @file fd.hpp
+ * @author Jesús Blanco
+ * @brief An owning file descriptor (`Fd`) for POSIX systems.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "safety.hpp"
+#include "types.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#endif
+
+namespace cy {
+/**
+ * @brief An `errno` value, as returned by failed system calls.
+ */
+struct Errno
+{
+    int32 code;
+
+    /**
+     * @brief Captures the current value of `errno`.
+     */
+    static inline Errno last() { return Errno{ errno }; }
+
+    /**
+     * @brief A human readable description of the error.
+     */
+    inline str message() const { return std::strerror(this->code); }
+
+    inline bool operator==(Errno other) const
+    {
+        return this->code == other.code;
+    }
+    inline bool operator!=(Errno other) const
+    {
+        return this->code != other.code;
+    }
+};
+
+/**
+ * @brief An owning file descriptor. It is closed exactly once, when the `Fd`
+ * holding it is destroyed, and `Fd` can only be moved, not copied.
+ *
+ * The invalid descriptor `-1` is declared as the niche of `Fd`, and is also
+ * its moved-from state, so `Maybe<Fd>` is 4 bytes and `Result<Fd, Errno>` is
+ * 8.
+ */
+class Fd
+{
+  private:
+    int32 fd;
+
+    explicit Fd(int32 fd)
+        : fd(fd)
+    {
+    }
+
+    static inline Result<Fd, Errno> check(int32 fd)
+    {
+        if (fd < 0)
+            return Err(Errno::last());
+
+        return Ok(Fd(fd));
+    }
+
+  public:
+    friend Niche<Fd>;
+
+    ~Fd()
+    {
+        if (this->fd >= 0)
+            ::close(this->fd);
+    }
+
+    Fd(Fd const &) = delete;
+    Fd &operator=(Fd const &) = delete;
+
+    Fd(Fd &&other) noexcept
+        : fd(std::exchange(other.fd, -1))
+    {
+    }
+
+    Fd &operator=(Fd &&other) noexcept
+    {
+        if (this != &other) {
+            if (this->fd >= 0)
+                ::close(this->fd);
+            this->fd = std::exchange(other.fd, -1);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Takes ownership of the raw descriptor `fd`, which must be valid.
+     */
+    static inline Fd from_raw(int32 fd) { return Fd(fd); }
+
+    /**
+     * @brief Opens `path`, see `open(2)`.
+     */
+    static inline Result<Fd, Errno> open(str path, int32 flags, int32 mode = 0)
+    {
+        return check(::open(path, flags, mode));
+    }
+
+    /**
+     * @brief Creates a pair of connected sockets, see `socketpair(2)`.
+     */
+    static Result<std::pair<Fd, Fd>, Errno> socketpair(int32 domain,
+                                                       int32 type,
+                                                       int32 protocol = 0)
+    {
+        int32 fds[2];
+
+        if (::socketpair(domain, type, protocol, fds) < 0)
+            return Err(Errno::last());
+
+        return Ok(std::make_pair(Fd(fds[0]), Fd(fds[1])));
+    }
+
+#if defined(__linux__)
+    /**
+     * @brief Creates an event notification descriptor, see `eventfd(2)`.
+     */
+    static inline Result<Fd, Errno> eventfd(uint32 initval, int32 flags = 0)
+    {
+        return check(::eventfd(initval, flags));
+    }
+
+    /**
+     * @brief Creates an anonymous in-memory file, see `memfd_create(2)`.
+     */
+    static inline Result<Fd, Errno> memfd_create(str name, uint32 flags = 0)
+    {
+        return check(::memfd_create(name, flags));
+    }
+#endif
+
+    /**
+     * @brief Gets the raw descriptor. Ownership is kept by `Fd`.
+     */
+    inline int32 raw() const { return this->fd; }
+
+    /**
+     * @brief Gives up ownership of the raw descriptor, which won't be closed
+     * by `Fd` anymore.
+     */
+    inline int32 release() { return std::exchange(this->fd, -1); }
+
+    /**
+     * @brief Duplicates the descriptor, see `dup(2)`. The copy has
+     * `FD_CLOEXEC` set.
+     */
+    inline Result<Fd, Errno> try_clone() const
+    {
+        return check(::fcntl(this->fd, F_DUPFD_CLOEXEC, 0));
+    }
+
+    /**
+     * @brief Reads up to `size` bytes into `buffer`, see `read(2)`.
+     */
+    Result<usize, Errno> read(void *buffer, usize size) const
+    {
+        ssize_t count = ::read(this->fd, buffer, size);
+        if (count < 0)
+            return Err(Errno::last());
+
+        return Ok(static_cast<usize>(count));
+    }
+
+    /**
+     * @brief Writes up to `size` bytes from `buffer`, see `write(2)`.
+     */
+    Result<usize, Errno> write(void const *buffer, usize size) const
+    {
+        ssize_t count = ::write(this->fd, buffer, size);
+        if (count < 0)
+            return Err(Errno::last());
+
+        return Ok(static_cast<usize>(count));
+    }
+
+    /**
+     * @brief Closes the descriptor now, reporting the error the destructor
+     * would ignore. The descriptor is released even if closing fails.
+     */
+    Result<void, Errno> close() &&
+    {
+        if (::close(this->release()) < 0)
+            return Err(Errno::last());
+
+        return Ok();
+    }
+};
+
+/**
+ * @brief The niche of `Fd` is the invalid descriptor `-1`.
+ */
+template<>
+struct Niche<Fd>
+{
+    static constexpr bool value = true;
+
+    static inline Fd   none() { return Fd(-1); }
+    static inline bool is_none(Fd const &fd) { return fd.fd == -1; }
+};
+}
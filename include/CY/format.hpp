@@ -0,0 +1,317 @@
+/**
+ * @file format.hpp
+ * @author Jesús Blanco
+ * @brief Allocation-free formatting into caller-provided buffers.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "safety.hpp"
+#include "types.hpp"
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+namespace cy {
+/**
+ * @brief The error of `format_to` when the output didn't fit in the buffer.
+ */
+struct Truncated
+{
+    /// @brief How many characters were written before running out of space.
+    usize written;
+};
+
+class FormatWriter;
+
+/**
+ * @brief Formats values of type `T`. Specialize it for your own types with a
+ * `static void write(FormatWriter &out, T const &value)`.
+ *
+ * @ref FormatWriter
+ */
+template<typename T, typename = void>
+struct Formatter;
+
+/**
+ * @brief Writes into a fixed `char` buffer, remembering whether something
+ * didn't fit. It never allocates.
+ */
+class FormatWriter
+{
+  private:
+    char *cursor;
+    char *end;
+    bool  truncated;
+
+  public:
+    FormatWriter(char *buffer, usize size)
+        : cursor(buffer)
+        , end(buffer + size)
+        , truncated(false)
+    {
+    }
+
+    /**
+     * @brief Whether some of the output didn't fit into the buffer.
+     */
+    inline bool is_truncated() const { return this->truncated; }
+    /**
+     * @brief Space left in the buffer.
+     */
+    inline usize remaining() const
+    {
+        return static_cast<usize>(this->end - this->cursor);
+    }
+    /**
+     * @brief Where the next character will be written.
+     */
+    inline char *position() const { return this->cursor; }
+
+    /**
+     * @brief Writes `s`, or as much of it as fits.
+     */
+    void write(strview s)
+    {
+        usize count = s.size();
+
+        if (count > this->remaining()) {
+            count = this->remaining();
+            this->truncated = true;
+        }
+
+        std::memcpy(this->cursor, s.data(), count);
+        this->cursor += count;
+    }
+
+    /**
+     * @brief Writes a single character, if it fits.
+     */
+    void put(char c)
+    {
+        if (this->cursor == this->end) {
+            this->truncated = true;
+            return;
+        }
+
+        *this->cursor++ = c;
+    }
+
+    /**
+     * @brief Writes a number through `std::to_chars`.
+     */
+    template<typename N, typename... Args>
+    void write_number(N value, Args... args)
+    {
+        auto direct = std::to_chars(this->cursor, this->end, value, args...);
+        if (direct.ec == std::errc()) {
+            this->cursor = direct.ptr;
+            return;
+        }
+
+        // Only partially fits: render it aside and keep what fits.
+        char tmp[128];
+        auto aside = std::to_chars(tmp, tmp + sizeof(tmp), value, args...);
+        this->write(strview(tmp, static_cast<usize>(aside.ptr - tmp)));
+    }
+
+    /**
+     * @brief Writes `value` through its `Formatter<T>`.
+     */
+    template<typename T>
+    inline void format(T const &value)
+    {
+        Formatter<T>::write(*this, value);
+    }
+};
+
+template<typename T>
+struct Formatter<T,
+                 std::enable_if_t<std::is_integral_v<T> &&
+                                  !std::is_same_v<T, bool> &&
+                                  !std::is_same_v<T, char>>>
+{
+    static void write(FormatWriter &out, T value) { out.write_number(value); }
+};
+
+template<typename T>
+struct Formatter<T, std::enable_if_t<std::is_floating_point_v<T>>>
+{
+    static void write(FormatWriter &out, T value) { out.write_number(value); }
+};
+
+template<>
+struct Formatter<bool>
+{
+    static void write(FormatWriter &out, bool value)
+    {
+        out.write(value ? "true" : "false");
+    }
+};
+
+template<>
+struct Formatter<char>
+{
+    static void write(FormatWriter &out, char value) { out.put(value); }
+};
+
+template<>
+struct Formatter<str>
+{
+    static void write(FormatWriter &out, str value) { out.write(value); }
+};
+
+template<>
+struct Formatter<ncstr>
+{
+    static void write(FormatWriter &out, ncstr value) { out.write(value); }
+};
+
+/**
+ * @brief Char arrays are written up to their first NUL (a buffer may hold a
+ * shorter string), or whole if they have none.
+ */
+template<usize N>
+struct Formatter<char[N]>
+{
+    static void write(FormatWriter &out, char const (&value)[N])
+    {
+        usize len = 0;
+        while (len < N && value[len] != '\0')
+            len++;
+
+        out.write(strview(value, len));
+    }
+};
+
+template<>
+struct Formatter<strview>
+{
+    static void write(FormatWriter &out, strview value) { out.write(value); }
+};
+
+template<>
+struct Formatter<std::string>
+{
+    static void write(FormatWriter &out, std::string const &value)
+    {
+        out.write(value);
+    }
+};
+
+/**
+ * @brief Pointers other than strings are written as their address, in hex.
+ */
+template<typename T>
+struct Formatter<T *, std::enable_if_t<!std::is_same_v<T, char const> &&
+                                       !std::is_same_v<T, char>>>
+{
+    static void write(FormatWriter &out, T const *value)
+    {
+        out.write("0x");
+        out.write_number(reinterpret_cast<uintptr_t>(value), 16);
+    }
+};
+
+/**
+ * @brief Writes `Some(..)` or `None`.
+ */
+template<typename T>
+struct Formatter<Maybe<T>>
+{
+    static void write(FormatWriter &out, Maybe<T> const &value)
+    {
+        if (value.is_none()) {
+            out.write("None");
+            return;
+        }
+
+        out.write("Some(");
+        out.format(value.get());
+        out.put(')');
+    }
+};
+
+/**
+ * @brief Writes `Ok(..)` or `Err(..)`. `Result<void, E>` writes `Ok` alone.
+ *
+ * @exception std::runtime_error Thrown if the `Result<T, E>` was already
+ * unwrapped, like `.get()` would.
+ */
+template<typename T, typename E>
+struct Formatter<Result<T, E>>
+{
+    static void write(FormatWriter &out, Result<T, E> const &value)
+    {
+        if (value.is_err()) {
+            out.write("Err(");
+            out.format(value.get_err());
+            out.put(')');
+            return;
+        }
+
+        if constexpr (std::is_void_v<T>) {
+            out.write("Ok");
+        } else {
+            out.write("Ok(");
+            out.format(value.get());
+            out.put(')');
+        }
+    }
+};
+
+/**
+ * @brief A caller-provided `char` buffer to format into. Made from a `char`
+ * array, or from a pointer and a size (`{ ptr, size }`).
+ */
+struct FormatBuffer
+{
+    char *data;
+    usize size;
+
+    FormatBuffer(char *data, usize size)
+        : data(data)
+        , size(size)
+    {
+    }
+
+    template<usize N>
+    FormatBuffer(char (&array)[N])
+        : data(array)
+        , size(N)
+    {
+    }
+};
+
+/**
+ * @brief Formats every argument, in order, into `buffer`, followed by a null
+ * terminator. Nothing is allocated.
+ *
+ * @return `Ok` with the number of characters written (without the null
+ * terminator), or `Truncated` if the output (and its terminator) didn't fit.
+ * The buffer is null-terminated either way, unless its size is 0.
+ */
+template<typename... Args>
+Result<usize, Truncated> format_to(FormatBuffer buffer, Args const &...args)
+{
+    if (buffer.size == 0)
+        return Err(Truncated{ 0 });
+
+    FormatWriter out(buffer.data, buffer.size - 1);
+    (out.format(args), ...);
+    *out.position() = '\0';
+
+    auto written = static_cast<usize>(out.position() - buffer.data);
+    if (out.is_truncated())
+        return Err(Truncated{ written });
+
+    return Ok(written);
+}
+}
@@ -0,0 +1,44 @@
+/**
+ * @file hash.hpp
+ * @author Jesús Blanco
+ * @brief Compile-time string hashing (`fnv1a`, `mix64`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "types.hpp"
+
+namespace cy {
+/**
+ * @brief The 64-bit FNV-1a hash of `text`. Usable in constant expressions, so
+ * hashes of literals cost nothing at runtime.
+ */
+constexpr uint64 fnv1a(strview text, uint64 seed = 0xcbf29ce484222325)
+{
+    uint64 hash = seed;
+    for (char c : text)
+        hash = (hash ^ static_cast<uint8>(c)) * 0x100000001b3;
+
+    return hash;
+}
+
+/**
+ * @brief Scrambles the bits of `x` (MurmurHash3's finalizer), so that every
+ * bit of the result depends on every bit of `x`. FNV-1a alone mixes its low
+ * bits poorly.
+ */
+constexpr uint64 mix64(uint64 x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccd;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53;
+    x ^= x >> 33;
+    return x;
+}
+}
@@ -0,0 +1,304 @@
+/**
+ * @file histogram.hpp
+ * @author Jesús Blanco
+ * @brief A lock-free logarithmic histogram for latencies (`Histogram`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "cache_padded.hpp"
+#include "instant.hpp"
+#include "safety.hpp"
+#include "sharded_counter.hpp"
+#include "types.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace cy {
+namespace detail {
+/**
+ * @brief Maps values to buckets HDR-style: values below `2^PRECISION` get one
+ * bucket each, and every power of two above that is split into
+ * `2^PRECISION` buckets, so a bucket is never wider than `1/2^PRECISION` of
+ * the values it holds.
+ */
+struct HistogramBuckets
+{
+    static constexpr uint32 PRECISION = 7;
+    static constexpr uint32 MAX_BITS = 40;
+    static constexpr uint64 SUB_COUNT = uint64(1) << PRECISION;
+    static constexpr usize  COUNT = (MAX_BITS - PRECISION + 1) * SUB_COUNT;
+    /// @brief Larger values are recorded as this one (about 18 minutes, in
+    /// nanoseconds).
+    static constexpr uint64 MAX_VALUE = (uint64(1) << MAX_BITS) - 1;
+
+    static inline uint32 msb(uint64 value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63 - static_cast<uint32>(__builtin_clzll(value));
+#else
+        uint32 bit = 0;
+        while (value >>= 1)
+            bit++;
+        return bit;
+#endif
+    }
+
+    static inline usize index_of(uint64 value)
+    {
+        value = std::min(value, MAX_VALUE);
+        if (value < SUB_COUNT)
+            return static_cast<usize>(value);
+
+        uint32 shift = msb(value) - PRECISION;
+        return static_cast<usize>(((shift + 1) << PRECISION) +
+                                  ((value >> shift) & (SUB_COUNT - 1)));
+    }
+
+    /**
+     * @brief The largest value that lands on bucket `index`.
+     */
+    static inline uint64 highest_of(usize index)
+    {
+        if (index < SUB_COUNT)
+            return index;
+
+        uint32 shift = static_cast<uint32>(index >> PRECISION) - 1;
+        uint64 sub = (index & (SUB_COUNT - 1)) | SUB_COUNT;
+        return ((sub + 1) << shift) - 1;
+    }
+};
+
+/**
+ * @brief `shard_hint()`, looked up once per thread. Threads rarely migrate, and
+ * asking for the CPU on every call would cost more than the recording itself.
+ */
+inline usize thread_shard()
+{
+    thread_local usize shard = shard_hint();
+    return shard;
+}
+}
+
+/**
+ * @brief The merged counts of one or more `Histogram`s, which can be queried
+ * for percentiles.
+ */
+class HistogramSnapshot
+{
+  private:
+    using Buckets = detail::HistogramBuckets;
+
+    std::vector<uint64> counts;
+    uint64              total;
+    uint64              largest;
+
+  public:
+    friend class Histogram;
+
+    HistogramSnapshot()
+        : counts(Buckets::COUNT, 0)
+        , total(0)
+        , largest(0)
+    {
+    }
+
+    /**
+     * @brief Number of recorded values.
+     */
+    inline uint64 count() const { return this->total; }
+
+    /**
+     * @brief The largest recorded value, exactly.
+     */
+    Maybe<uint64> max() const
+    {
+        if (this->total == 0)
+            return None();
+
+        return Some(this->largest);
+    }
+
+    /**
+     * @brief The value below which `percentile`% of the recorded values fall,
+     * within the relative error of the buckets (and never above `max()`).
+     *
+     * @param percentile From 0 to 100, e.g. 50, 99 or 99.9.
+     */
+    Maybe<uint64> percentile(float64 percentile) const
+    {
+        if (this->total == 0)
+            return None();
+
+        percentile = std::clamp(percentile, 0.0, 100.0);
+        auto rank = static_cast<uint64>(percentile / 100.0 * this->total);
+        rank = std::clamp<uint64>(rank, 1, this->total);
+
+        uint64 seen = 0;
+        for (usize i = 0; i < this->counts.size(); i++) {
+            seen += this->counts[i];
+            if (seen >= rank)
+                return Some(std::min(Buckets::highest_of(i), this->largest));
+        }
+
+        return Some(this->largest);
+    }
+
+    /**
+     * @brief The mean of the recorded values, within the relative error of the
+     * buckets.
+     */
+    Maybe<float64> mean() const
+    {
+        if (this->total == 0)
+            return None();
+
+        float64 sum = 0;
+        for (usize i = 0; i < this->counts.size(); i++) {
+            if (this->counts[i] != 0)
+                sum += static_cast<float64>(this->counts[i]) *
+                       static_cast<float64>(Buckets::highest_of(i));
+        }
+
+        return Some(sum / static_cast<float64>(this->total));
+    }
+
+    /**
+     * @brief Adds the counts of `other` to this snapshot.
+     */
+    HistogramSnapshot &merge(HistogramSnapshot const &other)
+    {
+        for (usize i = 0; i < this->counts.size(); i++)
+            this->counts[i] += other.counts[i];
+
+        this->total += other.total;
+        this->largest = std::max(this->largest, other.largest);
+        return *this;
+    }
+};
+
+/**
+ * @brief A logarithmic histogram which threads can record into concurrently,
+ * without locks. Values (usually nanoseconds) are kept with a relative error
+ * under 1%, up to `detail::HistogramBuckets::MAX_VALUE`.
+ *
+ * Each thread records into the cache-aligned shard of the CPU it started on,
+ * with relaxed atomics, and `snapshot()` merges every shard.
+ */
+class Histogram
+{
+  private:
+    using Buckets = detail::HistogramBuckets;
+
+    struct alignas(CACHE_LINE_SIZE) Shard
+    {
+        std::atomic<uint64> counts[Buckets::COUNT];
+        std::atomic<uint64> largest;
+    };
+
+    std::unique_ptr<Shard[]> shards;
+    usize                    mask;
+
+  public:
+    /**
+     * @brief Creates a histogram with at least `shards` shards (rounded up to
+     * a power of two). By default, one per hardware thread.
+     */
+    explicit Histogram(usize shards = std::thread::hardware_concurrency())
+    {
+        usize count = 1;
+        while (count < shards)
+            count *= 2;
+
+        this->shards.reset(new Shard[count]());
+        this->mask = count - 1;
+    }
+
+    Histogram(Histogram const &) = delete;
+    Histogram &operator=(Histogram const &) = delete;
+
+    /**
+     * @brief Records `value`.
+     */
+    inline void record(uint64 value)
+    {
+        Shard &shard = this->shards[detail::thread_shard() & this->mask];
+
+        shard.counts[Buckets::index_of(value)].fetch_add(
+            1, std::memory_order_relaxed);
+
+        uint64 largest = shard.largest.load(std::memory_order_relaxed);
+        while (value > largest &&
+               !shard.largest.compare_exchange_weak(
+                   largest, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    /**
+     * @brief Merges every shard into a snapshot. Values recorded while it runs
+     * may or may not be included.
+     */
+    HistogramSnapshot snapshot() const
+    {
+        HistogramSnapshot snapshot;
+
+        for (usize s = 0; s <= this->mask; s++) {
+            Shard const &shard = this->shards[s];
+
+            for (usize i = 0; i < Buckets::COUNT; i++) {
+                uint64 count = shard.counts[i].load(std::memory_order_relaxed);
+                snapshot.counts[i] += count;
+                snapshot.total += count;
+            }
+            snapshot.largest =
+                std::max(snapshot.largest,
+                         shard.largest.load(std::memory_order_relaxed));
+        }
+
+        return snapshot;
+    }
+
+    /**
+     * @brief Clears every shard.
+     */
+    void reset()
+    {
+        for (usize s = 0; s <= this->mask; s++) {
+            for (auto &count : this->shards[s].counts)
+                count.store(0, std::memory_order_relaxed);
+            this->shards[s].largest.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+/**
+ * @brief Records the nanoseconds between its construction and destruction
+ * into a `Histogram`, timed with `Instant`.
+ */
+class ScopedTimer
+{
+  private:
+    Histogram &histogram;
+    Instant    start;
+
+  public:
+    explicit ScopedTimer(Histogram &histogram)
+        : histogram(histogram)
+        , start(Instant::now())
+    {
+    }
+
+    ScopedTimer(ScopedTimer const &) = delete;
+    ScopedTimer &operator=(ScopedTimer const &) = delete;
+
+    ~ScopedTimer() { this->histogram.record(this->start.elapsed().as_nanos()); }
+};
+}
@@ -0,0 +1,284 @@
+/**
+ * @file instant.hpp
+ * @author Jesús Blanco
+ * @brief Cheap monotonic timestamps on the TSC (`Instant` and `Duration`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "types.hpp"
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define CY_HAS_TSC 1
+#else
+#define CY_HAS_TSC 0
+#endif
+
+namespace cy {
+/**
+ * @brief A span of time, in nanoseconds.
+ */
+class Duration
+{
+  private:
+    uint64 nanos;
+
+    constexpr explicit Duration(uint64 nanos)
+        : nanos(nanos)
+    {
+    }
+
+  public:
+    constexpr Duration()
+        : nanos(0)
+    {
+    }
+
+    static constexpr Duration from_nanos(uint64 nanos)
+    {
+        return Duration(nanos);
+    }
+    static constexpr Duration from_micros(uint64 micros)
+    {
+        return Duration(micros * 1000);
+    }
+    static constexpr Duration from_millis(uint64 millis)
+    {
+        return Duration(millis * 1000000);
+    }
+    static constexpr Duration from_secs(uint64 secs)
+    {
+        return Duration(secs * 1000000000);
+    }
+
+    inline constexpr uint64  as_nanos() const { return this->nanos; }
+    inline constexpr uint64  as_micros() const { return this->nanos / 1000; }
+    inline constexpr uint64  as_millis() const { return this->nanos / 1000000; }
+    inline constexpr float64 as_secs_f64() const
+    {
+        return static_cast<float64>(this->nanos) / 1e9;
+    }
+
+    inline constexpr std::chrono::nanoseconds to_chrono() const
+    {
+        return std::chrono::nanoseconds(this->nanos);
+    }
+
+    inline constexpr Duration operator+(Duration other) const
+    {
+        return Duration(this->nanos + other.nanos);
+    }
+    /**
+     * @brief Saturates at zero instead of wrapping.
+     */
+    inline constexpr Duration operator-(Duration other) const
+    {
+        return Duration(this->nanos > other.nanos ? this->nanos - other.nanos
+                                                  : 0);
+    }
+
+    inline constexpr bool operator==(Duration other) const
+    {
+        return this->nanos == other.nanos;
+    }
+    inline constexpr bool operator!=(Duration other) const
+    {
+        return this->nanos != other.nanos;
+    }
+    inline constexpr bool operator<(Duration other) const
+    {
+        return this->nanos < other.nanos;
+    }
+    inline constexpr bool operator<=(Duration other) const
+    {
+        return this->nanos <= other.nanos;
+    }
+    inline constexpr bool operator>(Duration other) const
+    {
+        return this->nanos > other.nanos;
+    }
+    inline constexpr bool operator>=(Duration other) const
+    {
+        return this->nanos >= other.nanos;
+    }
+};
+
+namespace detail {
+/**
+ * @brief How `Instant` reads time, decided once per process.
+ */
+struct InstantClock
+{
+    /// @brief Whether instants are TSC ticks (or else nanoseconds).
+    bool    tsc;
+    float64 nanos_per_tick;
+};
+
+inline uint64 monotonic_nanos()
+{
+    // steady_clock is clock_gettime(CLOCK_MONOTONIC) on Linux and macOS.
+    return static_cast<uint64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+#if CY_HAS_TSC
+/**
+ * @brief Whether the CPU says its TSC ticks at a constant rate, in every
+ * power state, in sync across cores (CPUID 80000007h, EDX bit 8).
+ */
+inline bool has_invariant_tsc()
+{
+    uint32 eax, ebx, ecx, edx;
+    if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0 ||
+        eax < 0x80000007)
+        return false;
+
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    return (edx & (1u << 8)) != 0;
+}
+
+inline uint64 read_tsc() { return __rdtsc(); }
+
+/**
+ * @brief Measures the TSC frequency against the monotonic clock over ~5 ms.
+ */
+inline InstantClock calibrate_tsc()
+{
+    constexpr uint64 WINDOW = 5000000;
+
+    uint64 start_nanos = monotonic_nanos();
+    uint64 start_ticks = read_tsc();
+    uint64 end_nanos = start_nanos;
+    uint64 end_ticks = start_ticks;
+
+    while (end_nanos - start_nanos < WINDOW) {
+        end_nanos = monotonic_nanos();
+        end_ticks = read_tsc();
+    }
+
+    if (end_ticks <= start_ticks)
+        return InstantClock{ false, 1.0 };
+
+    return InstantClock{ true,
+                         static_cast<float64>(end_nanos - start_nanos) /
+                             static_cast<float64>(end_ticks - start_ticks) };
+}
+#endif
+
+inline InstantClock const &instant_clock()
+{
+#if CY_HAS_TSC
+    static InstantClock const clock =
+        has_invariant_tsc() ? calibrate_tsc() : InstantClock{ false, 1.0 };
+#else
+    static InstantClock const clock{ false, 1.0 };
+#endif
+    return clock;
+}
+}
+
+/**
+ * @brief A point on a monotonic clock, only meaningful compared with other
+ * `Instant`s of the same process.
+ *
+ * On x86 with an invariant TSC, `now()` is one RDTSC (a few nanoseconds,
+ * against ~20 for `std::chrono::steady_clock`), and ticks are turned into
+ * nanoseconds by a rate measured once against `CLOCK_MONOTONIC`, the first
+ * time an `Instant` is taken. Elsewhere it falls back to `CLOCK_MONOTONIC`.
+ *
+ * Measuring the rate spins for ~5 ms, so the first `now()` stalls for that
+ * long; call `calibrate()` at startup to take the stall there instead.
+ */
+class Instant
+{
+  private:
+    uint64 stamp;
+
+    explicit Instant(uint64 stamp)
+        : stamp(stamp)
+    {
+    }
+
+  public:
+    static inline Instant now()
+    {
+#if CY_HAS_TSC
+        if (detail::instant_clock().tsc)
+            return Instant(detail::read_tsc());
+#endif
+        return Instant(detail::monotonic_nanos());
+    }
+
+    /**
+     * @brief Measures the TSC rate now (~5 ms), if it hasn't been yet, so
+     * that no later `now()` pays for it. Calling it is optional.
+     */
+    static inline void calibrate() { (void)detail::instant_clock(); }
+
+    /**
+     * @brief Whether instants come from the TSC, rather than the fallback.
+     */
+    static inline bool is_tsc() { return detail::instant_clock().tsc; }
+
+    /**
+     * @brief Time from `earlier` to this instant, or zero if `earlier` is
+     * actually later.
+     */
+    inline Duration duration_since(Instant earlier) const
+    {
+        if (this->stamp <= earlier.stamp)
+            return Duration();
+
+        auto const &clock = detail::instant_clock();
+        uint64      ticks = this->stamp - earlier.stamp;
+        if (!clock.tsc)
+            return Duration::from_nanos(ticks);
+
+        return Duration::from_nanos(static_cast<uint64>(
+            static_cast<float64>(ticks) * clock.nanos_per_tick));
+    }
+
+    /**
+     * @brief Time since this instant.
+     */
+    inline Duration elapsed() const
+    {
+        return Instant::now().duration_since(*this);
+    }
+
+    inline bool operator==(Instant other) const
+    {
+        return this->stamp == other.stamp;
+    }
+    inline bool operator!=(Instant other) const
+    {
+        return this->stamp != other.stamp;
+    }
+    inline bool operator<(Instant other) const
+    {
+        return this->stamp < other.stamp;
+    }
+    inline bool operator<=(Instant other) const
+    {
+        return this->stamp <= other.stamp;
+    }
+    inline bool operator>(Instant other) const
+    {
+        return this->stamp > other.stamp;
+    }
+    inline bool operator>=(Instant other) const
+    {
+        return this->stamp >= other.stamp;
+    }
+};
+}
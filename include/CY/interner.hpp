@@ -0,0 +1,325 @@
+/**
+ * @file interner.hpp
+ * @author Jesús Blanco
+ * @brief A string interner handing out compact `Symbol` ids.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "safety.hpp"
+#include "types.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace cy {
+/**
+ * @brief The id of an interned string. Comparing and hashing symbols is
+ * comparing and hashing a `uint32`.
+ *
+ * @attention `UINT32_MAX` is reserved as the niche of `Symbol`, so
+ * `Maybe<Symbol>` is 4 bytes.
+ */
+class Symbol
+{
+  private:
+    uint32 id;
+
+  public:
+    friend Niche<Symbol>;
+
+    explicit constexpr Symbol(uint32 id)
+        : id(id)
+    {
+    }
+
+    /**
+     * @brief The index of this symbol, in interning order.
+     */
+    inline constexpr uint32 index() const { return this->id; }
+
+    inline constexpr bool operator==(Symbol other) const
+    {
+        return this->id == other.id;
+    }
+    inline constexpr bool operator!=(Symbol other) const
+    {
+        return this->id != other.id;
+    }
+    inline constexpr bool operator<(Symbol other) const
+    {
+        return this->id < other.id;
+    }
+};
+
+template<>
+struct Niche<Symbol>
+{
+    static constexpr bool value = true;
+
+    static constexpr Symbol none() { return Symbol(UINT32_MAX); }
+    static constexpr bool   is_none(Symbol const &symbol)
+    {
+        return symbol.id == UINT32_MAX;
+    }
+};
+
+namespace detail {
+/**
+ * @brief Bump allocator for string bytes. Chunks are never moved or freed
+ * before the arena itself, so views into it stay valid.
+ */
+class StringArena
+{
+  private:
+    static constexpr usize CHUNK_SIZE = 64 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> chunks;
+    char                                *cursor = nullptr;
+    usize                                left = 0;
+
+  public:
+    /**
+     * @brief Copies `s` into the arena, returning a view of the copy.
+     */
+    strview store(strview s)
+    {
+        if (s.size() > this->left) {
+            usize size = std::max(s.size(), CHUNK_SIZE);
+
+            this->chunks.emplace_back(new char[size]);
+            this->cursor = this->chunks.back().get();
+            this->left = size;
+        }
+
+        char *dst = this->cursor;
+        std::memcpy(dst, s.data(), s.size());
+        this->cursor += s.size();
+        this->left -= s.size();
+
+        return strview(dst, s.size());
+    }
+};
+}
+
+/**
+ * @brief Open addressing table from strings to symbols, plus the strings of
+ * every symbol. The published snapshots of an `Interner` are `SymbolTable`s,
+ * and never change once published, so any number of threads can read them.
+ */
+class SymbolTable
+{
+  private:
+    static constexpr uint32 EMPTY = UINT32_MAX;
+
+    struct Slot
+    {
+        uint32 tag;
+        uint32 symbol;
+    };
+
+    std::vector<Slot>    slots;
+    std::vector<strview> strings;
+
+    static inline uint32 tag_of(usize hash)
+    {
+        return static_cast<uint32>(static_cast<uint64>(hash) >> 32);
+    }
+
+    void grow()
+    {
+        usize capacity = std::max<usize>(16, this->slots.size() * 2);
+
+        this->slots.assign(capacity, Slot{ 0, EMPTY });
+        for (uint32 i = 0; i < this->strings.size(); i++) {
+            this->place(std::hash<strview>()(this->strings[i]), i);
+        }
+    }
+
+    void place(usize hash, uint32 symbol)
+    {
+        usize mask = this->slots.size() - 1;
+
+        for (usize i = hash & mask;; i = (i + 1) & mask) {
+            if (this->slots[i].symbol == EMPTY) {
+                this->slots[i] = Slot{ tag_of(hash), symbol };
+                return;
+            }
+        }
+    }
+
+  public:
+    friend class Interner;
+
+    /**
+     * @brief Looks for the symbol of `s`, which must be hashed by
+     * `std::hash<strview>`.
+     */
+    Maybe<Symbol> lookup(strview s, usize hash) const
+    {
+        if (this->slots.empty())
+            return None();
+
+        usize  mask = this->slots.size() - 1;
+        uint32 tag = tag_of(hash);
+
+        for (usize i = hash & mask;; i = (i + 1) & mask) {
+            Slot const &slot = this->slots[i];
+
+            if (slot.symbol == EMPTY)
+                return None();
+            if (slot.tag == tag && this->strings[slot.symbol] == s)
+                return Some(Symbol(slot.symbol));
+        }
+    }
+
+    /**
+     * @brief Looks for the symbol of `s`.
+     */
+    inline Maybe<Symbol> lookup(strview s) const
+    {
+        return this->lookup(s, std::hash<strview>()(s));
+    }
+
+    /**
+     * @brief Gets the string of `symbol`.
+     *
+     * @exception std::out_of_range Thrown if `symbol` doesn't belong to this
+     * table.
+     */
+    strview resolve(Symbol symbol) const
+    {
+        if (symbol.index() >= this->strings.size())
+            throw std::out_of_range("Called .resolve() with an unknown symbol");
+
+        return this->strings[symbol.index()];
+    }
+
+    /**
+     * @brief Number of symbols in this table.
+     */
+    inline usize size() const { return this->strings.size(); }
+};
+
+/**
+ * @brief Maps strings to compact `Symbol` ids and back. Interned strings are
+ * copied into an arena and stay valid (and at the same address) for as long
+ * as the interner lives.
+ *
+ * `intern`, `lookup`, `resolve` and `publish` must be called from a single
+ * thread (or under a lock). Other threads read through `published()`, which is
+ * lock-free and sees every symbol interned before the last `publish()`.
+ *
+ * @attention Published snapshots are kept until the interner is destroyed, so
+ * publishing should happen after batches of interning, not after each one.
+ */
+class Interner
+{
+  private:
+    detail::StringArena                       arena;
+    SymbolTable                               table;
+    std::vector<std::unique_ptr<SymbolTable>> snapshots;
+    std::atomic<SymbolTable const *>          snapshot;
+
+  public:
+    Interner()
+    {
+        this->snapshots.emplace_back(new SymbolTable());
+        this->snapshot.store(this->snapshots.back().get(),
+                             std::memory_order_release);
+    }
+
+    Interner(Interner const &) = delete;
+    Interner &operator=(Interner const &) = delete;
+
+    /**
+     * @brief Gets the symbol of `s`, interning a copy of it if it's new.
+     *
+     * @exception std::length_error Thrown if the interner ran out of symbols.
+     */
+    Symbol intern(strview s)
+    {
+        usize hash = std::hash<strview>()(s);
+        auto  found = this->table.lookup(s, hash);
+
+        if (found.is_some())
+            return found.get();
+
+        if (this->table.strings.size() >= UINT32_MAX)
+            throw std::length_error("Interner ran out of symbols");
+
+        auto symbol = static_cast<uint32>(this->table.strings.size());
+        this->table.strings.push_back(this->arena.store(s));
+
+        if (this->table.strings.size() * 2 > this->table.slots.size())
+            this->table.grow();
+        else
+            this->table.place(hash, symbol);
+
+        return Symbol(symbol);
+    }
+
+    /**
+     * @brief Gets the symbol of `s`, if it was interned.
+     */
+    inline Maybe<Symbol> lookup(strview s) const
+    {
+        return this->table.lookup(s);
+    }
+
+    /**
+     * @brief Gets the string of `symbol`.
+     *
+     * @exception std::out_of_range Thrown if `symbol` wasn't handed out by
+     * this interner.
+     */
+    inline strview resolve(Symbol symbol) const
+    {
+        return this->table.resolve(symbol);
+    }
+
+    /**
+     * @brief Number of interned strings.
+     */
+    inline usize size() const { return this->table.size(); }
+
+    /**
+     * @brief Makes every symbol interned so far visible to `published()`.
+     */
+    void publish()
+    {
+        this->snapshots.emplace_back(new SymbolTable(this->table));
+        this->snapshot.store(this->snapshots.back().get(),
+                             std::memory_order_release);
+    }
+
+    /**
+     * @brief Gets the last published snapshot. Safe to call and read from any
+     * thread while the interner is alive.
+     */
+    inline SymbolTable const &published() const
+    {
+        return *this->snapshot.load(std::memory_order_acquire);
+    }
+};
+}
+
+namespace std {
+template<>
+struct hash<cy::Symbol>
+{
+    inline usize operator()(cy::Symbol symbol) const
+    {
+        return std::hash<uint32>()(symbol.index());
+    }
+};
+}
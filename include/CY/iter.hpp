@@ -0,0 +1,603 @@
+/**
+ * @file iter.hpp
+ * @author Jesús Blanco
+ * @brief Pull iterators whose `next()` returns `Maybe<T>` (`Iter`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "safety.hpp"
+#include "types.hpp"
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cy {
+/**
+ * @brief Up to `N` values pulled at once from an iterator. Only the first
+ * `len` of `items` are valid; fewer than `N` means the iterator ran out.
+ */
+template<typename T, usize N>
+struct Chunk
+{
+    std::array<T, N> items;
+    usize            len = 0;
+
+    inline bool     is_full() const { return this->len == N; }
+    inline T       *begin() { return this->items.data(); }
+    inline T       *end() { return this->items.data() + this->len; }
+    inline T const *begin() const { return this->items.data(); }
+    inline T const *end() const { return this->items.data() + this->len; }
+};
+
+namespace detail {
+template<typename Inner, typename F>
+class Map;
+template<typename Inner, typename P>
+class Filter;
+template<typename Inner, typename P>
+class TakeWhile;
+template<typename A, typename B>
+class Zip;
+template<typename A, typename B>
+class Chain;
+template<typename Inner>
+class Enumerate;
+}
+
+/**
+ * @brief Base of every iterator, yielding `T`s (which may be references). An
+ * iterator is a `Derived` class with a `Maybe<T> next()` method, returning
+ * `None` once it runs out. This base provides the adaptors (`map`, `filter`,
+ * ...), which build new iterators calling `next()` on the one they wrap, so a
+ * whole chain inlines into a single loop.
+ *
+ * Adaptors consume the iterator they are called on (call them on temporaries,
+ * or `std::move` it). Terminal operations (`fold`, `collect`) drain it where
+ * it is.
+ *
+ * `fold` is the fast path: sources override it with a plain loop, and `map`,
+ * `filter`, `enumerate` and `chain` fold their inner iterator, so a chain over
+ * contiguous data ends up as one loop the compiler can vectorize. For batches,
+ * `next_chunk<N>()` pulls `N` values at once, copying straight out of
+ * contiguous sources.
+ */
+template<typename Derived, typename T>
+class Iter
+{
+  private:
+    inline Derived &self() { return static_cast<Derived &>(*this); }
+
+  public:
+    using Item = T;
+    using Value = std::decay_t<T>;
+
+    /**
+     * @brief Pulls up to `N` values (copies, if `T` is a reference). `Value`
+     * must be default constructible.
+     */
+    template<usize N>
+    Chunk<Value, N> next_chunk()
+    {
+        Chunk<Value, N> chunk;
+        while (chunk.len < N) {
+            Maybe<T> item = this->self().next();
+            if (item.is_none())
+                break;
+
+            chunk.items[chunk.len++] = item.unwrap();
+        }
+
+        return chunk;
+    }
+
+    /**
+     * @brief Yields `func(item)` for every item.
+     */
+    template<typename F>
+    detail::Map<Derived, std::decay_t<F>> map(F &&func) &&
+    {
+        return { std::move(this->self()), std::forward<F>(func) };
+    }
+
+    /**
+     * @brief Yields the items for which `predicate(item)` is true.
+     */
+    template<typename P>
+    detail::Filter<Derived, std::decay_t<P>> filter(P &&predicate) &&
+    {
+        return { std::move(this->self()), std::forward<P>(predicate) };
+    }
+
+    /**
+     * @brief Yields items until `predicate(item)` is false, dropping that item.
+     */
+    template<typename P>
+    detail::TakeWhile<Derived, std::decay_t<P>> take_while(P &&predicate) &&
+    {
+        return { std::move(this->self()), std::forward<P>(predicate) };
+    }
+
+    /**
+     * @brief Yields pairs of items from this iterator and `other`, until either
+     * runs out.
+     */
+    template<typename Other>
+    detail::Zip<Derived, Other> zip(Other other) &&
+    {
+        return { std::move(this->self()), std::move(other) };
+    }
+
+    /**
+     * @brief Yields the items of this iterator, then those of `other`.
+     */
+    template<typename Other>
+    detail::Chain<Derived, Other> chain(Other other) &&
+    {
+        return { std::move(this->self()), std::move(other) };
+    }
+
+    /**
+     * @brief Yields pairs of (index, item).
+     */
+    detail::Enumerate<Derived> enumerate() &&
+    {
+        return detail::Enumerate<Derived>(std::move(this->self()));
+    }
+
+    /**
+     * @brief Drains the iterator, accumulating `acc = func(acc, item)`.
+     */
+    template<typename Acc, typename F>
+    Acc fold(Acc acc, F &&func)
+    {
+        while (true) {
+            Maybe<T> item = this->self().next();
+            if (item.is_none())
+                return acc;
+
+            acc = func(std::move(acc), item.unwrap());
+        }
+    }
+
+    /**
+     * @brief Drains the iterator into a container (a `std::vector` of values
+     * by default), inserting each item at its end.
+     */
+    template<typename C = std::vector<Value>>
+    C collect()
+    {
+        C out;
+        while (true) {
+            Maybe<T> item = this->self().next();
+            if (item.is_none())
+                return out;
+
+            out.insert(out.end(), item.unwrap());
+        }
+    }
+};
+
+/**
+ * @brief Iterates over contiguous `T`s, yielding `T&`.
+ */
+template<typename T>
+class SliceIter : public Iter<SliceIter<T>, T &>
+{
+  private:
+    T *first;
+    T *last;
+
+  public:
+    SliceIter(T *data, usize len)
+        : first(data)
+        , last(data + len)
+    {
+    }
+
+    inline Maybe<T &> next()
+    {
+        if (this->first == this->last)
+            return None();
+
+        return Some<T &>(*this->first++);
+    }
+
+    template<usize N>
+    Chunk<std::remove_const_t<T>, N> next_chunk()
+    {
+        Chunk<std::remove_const_t<T>, N> chunk;
+        chunk.len = std::min<usize>(N, this->last - this->first);
+
+        if (chunk.len == N) {
+            for (usize i = 0; i < N; i++)
+                chunk.items[i] = this->first[i];
+        } else {
+            for (usize i = 0; i < chunk.len; i++)
+                chunk.items[i] = this->first[i];
+        }
+        this->first += chunk.len;
+
+        return chunk;
+    }
+
+    template<typename Acc, typename F>
+    Acc fold(Acc acc, F &&func)
+    {
+        for (; this->first != this->last; this->first++)
+            acc = func(std::move(acc), *this->first);
+
+        return acc;
+    }
+
+    /**
+     * @brief Number of items left.
+     */
+    inline usize len() const { return this->last - this->first; }
+};
+
+/**
+ * @brief Iterates over the integers in [begin, end).
+ */
+template<typename I>
+class RangeIter : public Iter<RangeIter<I>, I>
+{
+    static_assert(std::is_integral_v<I>, "RangeIter needs an integer type.");
+
+  private:
+    I current;
+    I last;
+
+  public:
+    RangeIter(I begin, I end)
+        : current(begin)
+        , last(std::max(begin, end))
+    {
+    }
+
+    inline Maybe<I> next()
+    {
+        if (this->current == this->last)
+            return None();
+
+        return Some(this->current++);
+    }
+
+    template<usize N>
+    Chunk<I, N> next_chunk()
+    {
+        Chunk<I, N> chunk;
+        chunk.len = std::min<usize>(N, this->last - this->current);
+
+        if (chunk.len == N) {
+            for (usize i = 0; i < N; i++)
+                chunk.items[i] = static_cast<I>(this->current + i);
+        } else {
+            for (usize i = 0; i < chunk.len; i++)
+                chunk.items[i] = static_cast<I>(this->current + i);
+        }
+        this->current += static_cast<I>(chunk.len);
+
+        return chunk;
+    }
+
+    template<typename Acc, typename F>
+    Acc fold(Acc acc, F &&func)
+    {
+        for (; this->current != this->last; this->current++)
+            acc = func(std::move(acc), this->current);
+
+        return acc;
+    }
+
+    /**
+     * @brief Number of items left.
+     */
+    inline usize len() const { return this->last - this->current; }
+};
+
+namespace detail {
+/**
+ * @see Iter::map
+ */
+template<typename Inner, typename F>
+class Map
+    : public Iter<Map<Inner, F>,
+                  std::invoke_result_t<F &, typename Inner::Item>>
+{
+  private:
+    using Base = Iter<Map<Inner, F>,
+                      std::invoke_result_t<F &, typename Inner::Item>>;
+
+    Inner inner;
+    F     func;
+
+  public:
+    using Item = typename Base::Item;
+    using Value = typename Base::Value;
+
+    Map(Inner inner, F func)
+        : inner(std::move(inner))
+        , func(std::move(func))
+    {
+    }
+
+    inline Maybe<Item> next()
+    {
+        auto item = this->inner.next();
+        if (item.is_none())
+            return None();
+
+        return Some<Item>(this->func(item.unwrap()));
+    }
+
+    /**
+     * @brief Maps a chunk of the inner iterator at once. `func` gets copies of
+     * the inner items, so use `next()` to modify them in place.
+     */
+    template<usize N>
+    Chunk<Value, N> next_chunk()
+    {
+        auto            in = this->inner.template next_chunk<N>();
+        Chunk<Value, N> chunk;
+        chunk.len = in.len;
+
+        if (in.is_full()) {
+            for (usize i = 0; i < N; i++)
+                chunk.items[i] = this->func(in.items[i]);
+        } else {
+            for (usize i = 0; i < in.len; i++)
+                chunk.items[i] = this->func(in.items[i]);
+        }
+
+        return chunk;
+    }
+
+    template<typename Acc, typename G>
+    Acc fold(Acc acc, G &&outer)
+    {
+        return this->inner.fold(
+            std::move(acc),
+            [this, &outer](Acc partial, typename Inner::Item item) {
+                return outer(std::move(partial),
+                            this->func(
+                                std::forward<typename Inner::Item>(item)));
+            });
+    }
+};
+
+/**
+ * @see Iter::filter
+ */
+template<typename Inner, typename P>
+class Filter : public Iter<Filter<Inner, P>, typename Inner::Item>
+{
+  private:
+    Inner inner;
+    P     predicate;
+
+  public:
+    using Item = typename Inner::Item;
+
+    Filter(Inner inner, P predicate)
+        : inner(std::move(inner))
+        , predicate(std::move(predicate))
+    {
+    }
+
+    inline Maybe<Item> next()
+    {
+        while (true) {
+            Maybe<Item> item = this->inner.next();
+            if (item.is_none() || this->predicate(item.get()))
+                return item;
+        }
+    }
+
+    template<typename Acc, typename F>
+    Acc fold(Acc acc, F &&func)
+    {
+        return this->inner.fold(
+            std::move(acc), [this, &func](Acc partial, Item item) {
+                if (!this->predicate(item))
+                    return partial;
+
+                return func(std::move(partial), std::forward<Item>(item));
+            });
+    }
+};
+
+/**
+ * @see Iter::take_while
+ */
+template<typename Inner, typename P>
+class TakeWhile : public Iter<TakeWhile<Inner, P>, typename Inner::Item>
+{
+  private:
+    Inner inner;
+    P     predicate;
+    bool  done = false;
+
+  public:
+    using Item = typename Inner::Item;
+
+    TakeWhile(Inner inner, P predicate)
+        : inner(std::move(inner))
+        , predicate(std::move(predicate))
+    {
+    }
+
+    inline Maybe<Item> next()
+    {
+        if (this->done)
+            return None();
+
+        Maybe<Item> item = this->inner.next();
+        if (item.is_some() && this->predicate(item.get()))
+            return item;
+
+        this->done = true;
+        return None();
+    }
+};
+
+/**
+ * @see Iter::zip
+ */
+template<typename A, typename B>
+class Zip
+    : public Iter<Zip<A, B>, std::pair<typename A::Item, typename B::Item>>
+{
+  private:
+    A a;
+    B b;
+
+  public:
+    using Item = std::pair<typename A::Item, typename B::Item>;
+
+    Zip(A a, B b)
+        : a(std::move(a))
+        , b(std::move(b))
+    {
+    }
+
+    inline Maybe<Item> next()
+    {
+        auto first = this->a.next();
+        if (first.is_none())
+            return None();
+
+        auto second = this->b.next();
+        if (second.is_none())
+            return None();
+
+        return Some<Item>(Item(first.unwrap(), second.unwrap()));
+    }
+};
+
+/**
+ * @see Iter::chain
+ */
+template<typename A, typename B>
+class Chain : public Iter<Chain<A, B>, typename A::Item>
+{
+    static_assert(std::is_same_v<typename A::Item, typename B::Item>,
+                  "Chained iterators must yield the same type.");
+
+  private:
+    A    a;
+    B    b;
+    bool first_done = false;
+
+  public:
+    using Item = typename A::Item;
+
+    Chain(A a, B b)
+        : a(std::move(a))
+        , b(std::move(b))
+    {
+    }
+
+    inline Maybe<Item> next()
+    {
+        if (!this->first_done) {
+            Maybe<Item> item = this->a.next();
+            if (item.is_some())
+                return item;
+
+            this->first_done = true;
+        }
+
+        return this->b.next();
+    }
+
+    template<typename Acc, typename F>
+    Acc fold(Acc acc, F &&func)
+    {
+        if (!this->first_done) {
+            acc = this->a.fold(std::move(acc), func);
+            this->first_done = true;
+        }
+
+        return this->b.fold(std::move(acc), func);
+    }
+};
+
+/**
+ * @see Iter::enumerate
+ */
+template<typename Inner>
+class Enumerate
+    : public Iter<Enumerate<Inner>, std::pair<usize, typename Inner::Item>>
+{
+  private:
+    Inner inner;
+    usize index = 0;
+
+  public:
+    using Item = std::pair<usize, typename Inner::Item>;
+
+    explicit Enumerate(Inner inner)
+        : inner(std::move(inner))
+    {
+    }
+
+    inline Maybe<Item> next()
+    {
+        auto item = this->inner.next();
+        if (item.is_none())
+            return None();
+
+        return Some<Item>(Item(this->index++, item.unwrap()));
+    }
+
+    template<typename Acc, typename F>
+    Acc fold(Acc acc, F &&func)
+    {
+        return this->inner.fold(
+            std::move(acc),
+            [this, &func](Acc partial, typename Inner::Item item) {
+                return func(std::move(partial),
+                            Item(this->index++,
+                                 std::forward<typename Inner::Item>(item)));
+            });
+    }
+};
+}
+
+/**
+ * @brief Iterates over `len` contiguous `T`s at `data`.
+ */
+template<typename T>
+inline SliceIter<T> iter(T *data, usize len)
+{
+    return SliceIter<T>(data, len);
+}
+
+/**
+ * @brief Iterates over a contiguous container (`std::vector`, `std::array`,
+ * C arrays...), yielding references to its elements.
+ */
+template<typename C>
+inline auto iter(C &container)
+{
+    return iter(std::data(container), std::size(container));
+}
+
+/**
+ * @brief Iterates over the integers in [begin, end).
+ */
+template<typename I>
+inline RangeIter<I> range(I begin, I end)
+{
+    return RangeIter<I>(begin, end);
+}
+}
@@ -0,0 +1,229 @@
+/**
+ * @file maybe_pack.hpp
+ * @author Jesús Blanco
+ * @brief Many optional fields packed together (`MaybePack<Fields...>`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "safety.hpp"
+#include "types.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <new>
+#include <tuple>
+#include <type_traits>
+
+namespace cy {
+namespace detail {
+/**
+ * @brief The smallest unsigned integer with at least `N` bits.
+ */
+template<usize N>
+using PresenceBits = std::conditional_t<
+    N <= 8,
+    uint8,
+    std::conditional_t<N <= 16,
+                       uint16,
+                       std::conditional_t<N <= 32, uint32, uint64>>>;
+
+/**
+ * @brief Offsets of `Fields...` when laid out by decreasing alignment, which
+ * needs no padding between them (sizes are multiples of alignments).
+ */
+template<typename... Fields>
+struct PackLayout
+{
+    static constexpr usize count = sizeof...(Fields);
+    static constexpr usize align = std::max({ alignof(Fields)... });
+
+    static constexpr std::array<usize, count> offsets()
+    {
+        constexpr usize sizes[] = { sizeof(Fields)... };
+        constexpr usize aligns[] = { alignof(Fields)... };
+
+        std::array<usize, count> result = {};
+        usize                    offset = 0;
+
+        for (usize a = align; a > 0; a /= 2) {
+            for (usize i = 0; i < count; i++) {
+                if (aligns[i] == a) {
+                    result[i] = offset;
+                    offset += sizes[i];
+                }
+            }
+        }
+
+        return result;
+    }
+
+    static constexpr usize size = (sizeof(Fields) + ...);
+};
+}
+
+/**
+ * @brief A record of optional fields, each one behaving like a `Maybe<T>`,
+ * which stores every presence flag as a bit of a single word and the values
+ * next to each other, without padding between them. Fields are accessed by
+ * index.
+ *
+ * `MaybePack<bool, uint8, uint16>` is 6 bytes, while three separate `Maybe`s
+ * take 8.
+ *
+ * @attention Fields must be trivially copyable and destructible (flags, small
+ * integers, enums...), and there can be at most 64 of them.
+ */
+template<typename... Fields>
+class MaybePack
+{
+    static_assert(sizeof...(Fields) > 0, "MaybePack<> is invalid.");
+    static_assert(sizeof...(Fields) <= 64,
+                  "MaybePack supports up to 64 fields.");
+    static_assert(((std::is_trivially_copyable_v<Fields> &&
+                    std::is_trivially_destructible_v<Fields>) &&
+                   ...),
+                  "MaybePack fields must be trivially copyable.");
+
+  private:
+    using Layout = detail::PackLayout<Fields...>;
+    using Bits = detail::PresenceBits<sizeof...(Fields)>;
+
+    static constexpr std::array<usize, Layout::count> offsets =
+        Layout::offsets();
+
+    alignas(Layout::align) unsigned char data[Layout::size] = {};
+    Bits bits = 0;
+
+    template<usize I>
+    static constexpr Bits mask = static_cast<Bits>(Bits(1) << I);
+
+    template<usize I>
+    inline void *slot()
+    {
+        return this->data + offsets[I];
+    }
+
+    template<usize I>
+    inline void const *slot() const
+    {
+        return this->data + offsets[I];
+    }
+
+  public:
+    /**
+     * @brief The type of the field at index `I`.
+     */
+    template<usize I>
+    using Field = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    /**
+     * @brief Number of fields.
+     */
+    static constexpr usize size() { return sizeof...(Fields); }
+
+    /**
+     * @brief Whether field `I` is set.
+     */
+    template<usize I>
+    inline bool is_some() const
+    {
+        return (this->bits & mask<I>) != 0;
+    }
+    /**
+     * @brief Opposite of `is_some`.
+     */
+    template<usize I>
+    inline bool is_none() const
+    {
+        return !this->is_some<I>();
+    }
+
+    /**
+     * @brief Gets a copy of field `I`.
+     */
+    template<usize I>
+    Maybe<Field<I>> get() const
+    {
+        if (!this->is_some<I>())
+            return None();
+
+        // Copied as bytes, so fields need no default constructor.
+        alignas(Field<I>) unsigned char buf[sizeof(Field<I>)];
+        std::memcpy(buf, this->slot<I>(), sizeof(Field<I>));
+        return Some(*std::launder(reinterpret_cast<Field<I> *>(buf)));
+    }
+
+    /**
+     * @brief Gets a reference to field `I`.
+     */
+    template<usize I>
+    Maybe<Field<I> &> get_ref()
+    {
+        if (!this->is_some<I>())
+            return None();
+
+        return Some<Field<I> &>(
+            *std::launder(static_cast<Field<I> *>(this->slot<I>())));
+    }
+
+    /**
+     * @brief Sets field `I` to `value`.
+     */
+    template<usize I>
+    void set(Field<I> value)
+    {
+        ::new (this->slot<I>()) Field<I>(value);
+        this->bits |= mask<I>;
+    }
+
+    /**
+     * @brief Sets field `I` to `value`, or clears it if `value` is `None`.
+     */
+    template<usize I>
+    void set(Maybe<Field<I>> const &value)
+    {
+        if (value.is_some())
+            this->set<I>(value.get());
+        else
+            this->reset<I>();
+    }
+
+    /**
+     * @brief Clears field `I`.
+     */
+    template<usize I>
+    inline void reset()
+    {
+        this->bits &= static_cast<Bits>(~mask<I>);
+    }
+
+    /**
+     * @brief Takes field `I` out, leaving it cleared.
+     */
+    template<usize I>
+    Maybe<Field<I>> take()
+    {
+        auto value = this->get<I>();
+        this->reset<I>();
+        return value;
+    }
+
+    /**
+     * @brief Number of fields which are set.
+     */
+    inline usize count() const
+    {
+        usize n = 0;
+        for (Bits b = this->bits; b != 0; b &= static_cast<Bits>(b - 1))
+            n++;
+
+        return n;
+    }
+};
+}
@@ -0,0 +1,385 @@
+/**
+ * @file packed_int_array.hpp
+ * @author Jesús Blanco
+ * @brief Arrays of integers packed into a fixed number of bits each
+ * (`PackedIntArray`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "safety.hpp"
+#include "span.hpp"
+#include "types.hpp"
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cy {
+/**
+ * @brief `PackedIntArray<DYNAMIC_BITS>` takes its width at runtime.
+ */
+constexpr uint32 DYNAMIC_BITS = 0;
+
+namespace detail {
+/**
+ * @brief Value `I` of a block of 64 `Bits`-bit values starting at `words`,
+ * with every offset known at compile time.
+ */
+template<uint32 Bits, usize I>
+inline uint64 packed_value(uint64 const *words)
+{
+    constexpr usize  WORD = I * Bits / 64;
+    constexpr uint32 SHIFT = I * Bits % 64;
+    constexpr uint64 MASK = Bits == 64 ? ~uint64(0) : (uint64(1) << Bits) - 1;
+
+    if constexpr (SHIFT + Bits <= 64)
+        return (words[WORD] >> SHIFT) & MASK;
+    else
+        return ((words[WORD] >> SHIFT) | (words[WORD + 1] << (64 - SHIFT))) &
+               MASK;
+}
+
+/**
+ * @brief Unpacks the 64 values (`Bits` whole words) at `words` into `out`,
+ * fully unrolled: each value is one or two loads, shifts and masks.
+ */
+template<uint32 Bits, typename U, usize... I>
+inline void unpack_block(uint64 const *words,
+                         U            *out,
+                         std::index_sequence<I...>)
+{
+    ((out[I] = static_cast<U>(packed_value<Bits, I>(words))), ...);
+}
+}
+
+/**
+ * @brief `len()` unsigned integers of `bits()` bits each (1 to 64), packed
+ * back to back into 64-bit words, so a column of 3-bit values takes 3 bits
+ * per value instead of 32 or 64.
+ *
+ * With `Bits` known at compile time every shift and mask is a constant; use
+ * `PackedIntArray<>` (`DYNAMIC_BITS`) to choose the width at runtime.
+ *
+ * @code
+ * cy::PackedIntArray<5> days(365); // 229 bytes instead of 1460.
+ * days.set(0, 17);
+ * @endcode
+ */
+template<uint32 Bits = DYNAMIC_BITS>
+class PackedIntArray
+{
+    static_assert(Bits <= 64, "PackedIntArray holds at most 64 bits a value.");
+
+  private:
+    // One more word than the values need, so reading the word after the one
+    // a value starts in is always in bounds.
+    std::vector<uint64> words;
+    usize               count;
+    uint32              width;
+
+    static inline usize words_for(usize len, uint32 bits)
+    {
+        return (len * bits + 63) / 64 + 1;
+    }
+
+  public:
+    /**
+     * @brief Creates `len` zeroes. Only for a compile-time `Bits`.
+     */
+    explicit PackedIntArray(usize len = 0)
+        : words(words_for(len, Bits))
+        , count(len)
+        , width(Bits)
+    {
+        static_assert(Bits != DYNAMIC_BITS,
+                      "PackedIntArray<> needs its width, (bits, len).");
+    }
+
+    /**
+     * @brief Creates `len` zeroes of `bits` bits each.
+     *
+     * @exception std::invalid_argument Thrown if `bits` is not between 1 and
+     * 64, or is not `Bits`.
+     */
+    PackedIntArray(uint32 bits, usize len)
+        : count(len)
+        , width(bits)
+    {
+        if (bits == 0 || bits > 64 || (Bits != DYNAMIC_BITS && bits != Bits))
+            throw std::invalid_argument("Invalid width for PackedIntArray");
+
+        this->words.resize(words_for(len, bits));
+    }
+
+    inline uint32 bits() const
+    {
+        if constexpr (Bits != DYNAMIC_BITS)
+            return Bits;
+        else
+            return this->width;
+    }
+
+    inline usize len() const { return this->count; }
+    inline bool  is_empty() const { return this->count == 0; }
+
+    /**
+     * @brief The largest value that fits in `bits()` bits.
+     */
+    inline uint64 max_value() const
+    {
+        return this->bits() == 64 ? ~uint64(0)
+                                  : (uint64(1) << this->bits()) - 1;
+    }
+
+    /**
+     * @brief Bytes taken by the packed values.
+     */
+    inline usize memory_usage() const
+    {
+        return this->words.size() * sizeof(uint64);
+    }
+
+    /**
+     * @brief The value at `index`, without checking bounds.
+     */
+    inline uint64 get_unchecked(usize index) const
+    {
+        usize         bit = index * this->bits();
+        uint64 const *word = this->words.data() + bit / 64;
+        uint32        shift = static_cast<uint32>(bit % 64);
+
+        // `high` is the part of the value that spills into the next word.
+        // Shifting in two steps keeps each shift below 64 when `shift` is 0.
+        uint64 low = word[0] >> shift;
+        uint64 high = (word[1] << 1) << (63 - shift);
+        return (low | high) & this->max_value();
+    }
+
+    /**
+     * @brief The value at `index`, or `None` if out of bounds.
+     */
+    inline Maybe<uint64> get(usize index) const
+    {
+        if (index >= this->count)
+            return None();
+
+        return Some(this->get_unchecked(index));
+    }
+
+    /**
+     * @brief Sets the value at `index` to `value` (truncated to `bits()`),
+     * without checking bounds.
+     */
+    inline void set_unchecked(usize index, uint64 value)
+    {
+        usize   bit = index * this->bits();
+        uint64 *word = this->words.data() + bit / 64;
+        uint32  shift = static_cast<uint32>(bit % 64);
+        uint64  mask = this->max_value();
+
+        value &= mask;
+        word[0] = (word[0] & ~(mask << shift)) | (value << shift);
+
+        if (shift + this->bits() > 64) {
+            uint32 spilled = 64 - shift;
+            word[1] = (word[1] & ~(mask >> spilled)) | (value >> spilled);
+        }
+    }
+
+    /**
+     * @brief Sets the value at `index` to `value`.
+     *
+     * @return false, and changes nothing, if `index` is out of bounds or
+     * `value` doesn't fit in `bits()` bits.
+     */
+    inline bool set(usize index, uint64 value)
+    {
+        if (index >= this->count || value > this->max_value())
+            return false;
+
+        this->set_unchecked(index, value);
+        return true;
+    }
+
+    /**
+     * @brief Appends `value`, or returns false if it doesn't fit in `bits()`
+     * bits.
+     */
+    bool push(uint64 value)
+    {
+        if (value > this->max_value())
+            return false;
+
+        this->count++;
+        this->words.resize(words_for(this->count, this->bits()));
+        this->set_unchecked(this->count - 1, value);
+        return true;
+    }
+
+    /**
+     * @brief Unpacks the `out.len()` values starting at `first` into `out`
+     * (`Span<uint32>` or `Span<uint64>`), checking the range once.
+     *
+     * With a compile-time `Bits`, runs of 64 values (which start and end on
+     * word boundaries) are unpacked by fully unrolled code with constant
+     * shifts and masks.
+     *
+     * @return false, and writes nothing, if the range is out of bounds or the
+     * values may not fit in a `U`.
+     */
+    template<typename U>
+    bool unpack(usize first, Span<U> out) const
+    {
+        static_assert(std::is_same_v<U, uint32> || std::is_same_v<U, uint64>,
+                      "unpack writes to Span<uint32> or Span<uint64>.");
+
+        if (first > this->count || out.len() > this->count - first ||
+            this->bits() > sizeof(U) * 8)
+            return false;
+
+        usize i = 0;
+        if constexpr (Bits != DYNAMIC_BITS) {
+            for (; i < out.len() && (first + i) % 64 != 0; i++)
+                out[i] = static_cast<U>(this->get_unchecked(first + i));
+
+            for (; out.len() - i >= 64; i += 64)
+                detail::unpack_block<Bits>(
+                    this->words.data() + (first + i) / 64 * Bits,
+                    out.data() + i,
+                    std::make_index_sequence<64>());
+        }
+
+        for (; i < out.len(); i++)
+            out[i] = static_cast<U>(this->get_unchecked(first + i));
+
+        return true;
+    }
+};
+
+/**
+ * @brief A `PackedIntArray` of optional values: `bits() + 1` bits each, the
+ * extra one in a validity bitmap, instead of a `Maybe<uint32>` or
+ * `Maybe<uint64>` (8 or 16 bytes).
+ */
+template<uint32 Bits = DYNAMIC_BITS>
+class NullablePackedIntArray
+{
+  private:
+    PackedIntArray<Bits> values;
+    PackedIntArray<1>    valid;
+
+  public:
+    /**
+     * @brief Creates `len` `None`s. Only for a compile-time `Bits`.
+     */
+    explicit NullablePackedIntArray(usize len = 0)
+        : values(len)
+        , valid(len)
+    {
+    }
+
+    /**
+     * @brief Creates `len` `None`s of `bits` bits each.
+     *
+     * @exception std::invalid_argument Thrown if `bits` is not between 1 and
+     * 64, or is not `Bits`.
+     */
+    NullablePackedIntArray(uint32 bits, usize len)
+        : values(bits, len)
+        , valid(len)
+    {
+    }
+
+    inline uint32 bits() const { return this->values.bits(); }
+    inline usize  len() const { return this->values.len(); }
+    inline bool   is_empty() const { return this->values.is_empty(); }
+    inline uint64 max_value() const { return this->values.max_value(); }
+
+    inline usize memory_usage() const
+    {
+        return this->values.memory_usage() + this->valid.memory_usage();
+    }
+
+    /**
+     * @brief Whether there is a value at `index` (false if out of bounds).
+     */
+    inline bool is_some(usize index) const
+    {
+        return index < this->len() && this->valid.get_unchecked(index) != 0;
+    }
+
+    /**
+     * @brief The value at `index`, or `None` if there is none or `index` is
+     * out of bounds.
+     */
+    inline Maybe<uint64> get(usize index) const
+    {
+        if (!this->is_some(index))
+            return None();
+
+        return Some(this->values.get_unchecked(index));
+    }
+
+    /**
+     * @brief Sets the value at `index`.
+     *
+     * @return false, and changes nothing, if `index` is out of bounds or
+     * `value` doesn't fit in `bits()` bits.
+     */
+    inline bool set(usize index, uint64 value)
+    {
+        if (!this->values.set(index, value))
+            return false;
+
+        this->valid.set_unchecked(index, 1);
+        return true;
+    }
+
+    /**
+     * @brief Clears the value at `index`. Returns false if out of bounds.
+     */
+    inline bool clear(usize index)
+    {
+        if (!this->valid.set(index, 0))
+            return false;
+
+        this->values.set_unchecked(index, 0);
+        return true;
+    }
+
+    /**
+     * @brief Appends `value` (or `None`), or returns false if it doesn't fit
+     * in `bits()` bits.
+     */
+    bool push(Maybe<uint64> value)
+    {
+        uint64 raw = value.is_some() ? value.get() : 0;
+        if (!this->values.push(raw))
+            return false;
+
+        this->valid.push(value.is_some() ? 1 : 0);
+        return true;
+    }
+
+    /**
+     * @see PackedIntArray::unpack. `None`s unpack as 0; the validity of each
+     * value can be unpacked from `validity()`.
+     */
+    template<typename U>
+    inline bool unpack(usize first, Span<U> out) const
+    {
+        return this->values.unpack(first, out);
+    }
+
+    /**
+     * @brief The validity bitmap: 1 where there is a value.
+     */
+    inline PackedIntArray<1> const &validity() const { return this->valid; }
+};
+}
@@ -0,0 +1,371 @@
+/**
+ * @file par_iter.hpp
+ * @author Jesús Blanco
+ * @brief Data-parallel iterators over slices and ranges (`par_iter`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "iter.hpp"
+#include "safety.hpp"
+#include "thread_pool.hpp"
+#include "types.hpp"
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cy {
+namespace detail {
+/**
+ * @brief The sequential iterator a parallel iterator `P` runs on each piece.
+ */
+template<typename P>
+using SeqOf = decltype(std::declval<P const &>().seq(0, 0));
+
+/**
+ * @brief What `try_for_each(func)` returns on a parallel iterator `P`.
+ */
+template<typename P, typename F>
+using TryForEach = Result<
+    void,
+    typename ResultTraits<
+        std::invoke_result_t<F &, typename SeqOf<P>::Item>>::Error>;
+
+/**
+ * @brief Runs `leaf(begin, end)` over pieces of [begin, end) of at most
+ * `grain` items, splitting in halves with `pool.join`, and combines the
+ * results of each half in order.
+ */
+template<typename Leaf, typename Combine>
+std::invoke_result_t<Leaf &, usize, usize> bridge(ThreadPool &pool,
+                                                  usize       begin,
+                                                  usize       end,
+                                                  usize       grain,
+                                                  Leaf       &leaf,
+                                                  Combine    &combine)
+{
+    if (end - begin <= grain)
+        return leaf(begin, end);
+
+    usize mid = begin + (end - begin) / 2;
+    auto [left, right] = pool.join(
+        [&]() { return bridge(pool, begin, mid, grain, leaf, combine); },
+        [&]() { return bridge(pool, mid, end, grain, leaf, combine); });
+
+    return combine(std::move(left), std::move(right));
+}
+
+template<typename Inner, typename F>
+class ParMap;
+template<typename Inner, typename P>
+class ParFilter;
+}
+
+/**
+ * @brief Base of the parallel iterators. A parallel iterator is a `Derived`
+ * class with a `len()` and a `seq(begin, end)` returning a sequential `Iter`
+ * over the items in [begin, end); pieces of it run on a `ThreadPool`
+ * (the one the caller works for, or `ThreadPool::global()`).
+ *
+ * `map` and `filter` are lazy and applied on each piece by the sequential
+ * adaptors. Functions are shared by every worker, so they must be safe to call
+ * concurrently.
+ */
+template<typename Derived>
+class ParIter
+{
+  private:
+    inline Derived const &self() const
+    {
+        return static_cast<Derived const &>(*this);
+    }
+
+    template<typename Leaf, typename Combine>
+    auto drive(Leaf leaf, Combine combine) const
+    {
+        ThreadPool *current = ThreadPool::current();
+        ThreadPool &pool = current != nullptr ? *current : ThreadPool::global();
+
+        usize len = this->self().len();
+        usize grain = std::max<usize>(1, len / (pool.size() * 8));
+
+        return pool.install([&]() {
+            return detail::bridge(pool, 0, len, grain, leaf, combine);
+        });
+    }
+
+  public:
+    /**
+     * @brief Yields `func(item)` for every item.
+     */
+    template<typename F>
+    detail::ParMap<Derived, std::decay_t<F>> map(F &&func) &&
+    {
+        return { std::move(static_cast<Derived &>(*this)),
+                 std::forward<F>(func) };
+    }
+
+    /**
+     * @brief Yields the items for which `predicate(item)` is true.
+     */
+    template<typename P>
+    detail::ParFilter<Derived, std::decay_t<P>> filter(P &&predicate) &&
+    {
+        return { std::move(static_cast<Derived &>(*this)),
+                 std::forward<P>(predicate) };
+    }
+
+    /**
+     * @brief Combines every item with `op`, starting each piece from
+     * `identity`. `op` must be associative, and take both `(T, item)` and
+     * `(T, T)`.
+     */
+    template<typename T, typename Op>
+    T reduce(T identity, Op &&op) const
+    {
+        auto leaf = [&](usize begin, usize end) {
+            return this->self().seq(begin, end).fold(identity, op);
+        };
+        auto combine = [&](T left, T right) {
+            return op(std::move(left), std::move(right));
+        };
+
+        return this->drive(leaf, combine);
+    }
+
+    /**
+     * @brief Calls `func(item)`, which returns a `Result<T, E>`, on every item,
+     * until one returns an `Err`. Returns the first (leftmost) `Err`, or `Ok`.
+     * Workers give up on their piece once an `Err` is found before it, so
+     * items after the first `Err` may or may not be visited.
+     */
+    template<typename F, typename D = Derived>
+    detail::TryForEach<D, F> try_for_each(F &&func) const
+    {
+        using Seq = detail::SeqOf<D>;
+        using R = std::invoke_result_t<F &, typename Seq::Item>;
+        using E = typename detail::ResultTraits<R>::Error;
+
+        // Lowest position an `Err` was found at. Positions are `begin` plus
+        // the number of items yielded so far, which keeps them in order
+        // across pieces even when `filter` skips items.
+        std::atomic<usize> failed_at{ std::numeric_limits<usize>::max() };
+
+        auto leaf = [&](usize begin, usize end) -> Maybe<E> {
+            auto it = this->self().seq(begin, end);
+
+            for (usize at = begin;
+                 at < failed_at.load(std::memory_order_relaxed);
+                 at++) {
+                auto item = it.next();
+                if (item.is_none())
+                    break;
+
+                R result = func(item.unwrap());
+                if (result.is_err()) {
+                    usize seen = failed_at.load(std::memory_order_relaxed);
+                    while (at < seen &&
+                           !failed_at.compare_exchange_weak(
+                               seen, at, std::memory_order_relaxed)) {
+                    }
+                    return Some(result.unwrap_err());
+                }
+            }
+
+            return None();
+        };
+        auto combine = [](Maybe<E> left, Maybe<E> right) {
+            return left.is_some() ? std::move(left) : std::move(right);
+        };
+
+        Maybe<E> error = this->drive(leaf, combine);
+        if (error.is_some())
+            return Err(error.unwrap());
+
+        return Ok();
+    }
+
+    /**
+     * @brief Collects every item into a `std::vector`, in order.
+     */
+    auto collect() const
+    {
+        using Value = typename detail::SeqOf<Derived>::Value;
+        using Pieces = std::list<std::vector<Value>>;
+
+        auto leaf = [this](usize begin, usize end) {
+            Pieces pieces;
+            pieces.push_back(this->self().seq(begin, end).collect());
+            return pieces;
+        };
+        auto combine = [](Pieces left, Pieces right) {
+            left.splice(left.end(), right);
+            return left;
+        };
+
+        Pieces pieces = this->drive(leaf, combine);
+
+        usize total = 0;
+        for (auto &piece : pieces)
+            total += piece.size();
+
+        std::vector<Value> out;
+        out.reserve(total);
+        for (auto &piece : pieces)
+            out.insert(out.end(),
+                       std::make_move_iterator(piece.begin()),
+                       std::make_move_iterator(piece.end()));
+
+        return out;
+    }
+};
+
+/**
+ * @brief Parallel iterator over contiguous `T`s, yielding `T&`.
+ */
+template<typename T>
+class ParSlice : public ParIter<ParSlice<T>>
+{
+  private:
+    T    *data;
+    usize count;
+
+  public:
+    ParSlice(T *data, usize len)
+        : data(data)
+        , count(len)
+    {
+    }
+
+    inline usize len() const { return this->count; }
+
+    inline SliceIter<T> seq(usize begin, usize end) const
+    {
+        return SliceIter<T>(this->data + begin, end - begin);
+    }
+};
+
+/**
+ * @brief Parallel iterator over the integers in [begin, end).
+ */
+template<typename I>
+class ParRange : public ParIter<ParRange<I>>
+{
+    static_assert(std::is_integral_v<I>, "ParRange needs an integer type.");
+
+  private:
+    I     first;
+    usize count;
+
+  public:
+    ParRange(I begin, I end)
+        : first(begin)
+        , count(end > begin ? static_cast<usize>(end - begin) : 0)
+    {
+    }
+
+    inline usize len() const { return this->count; }
+
+    inline RangeIter<I> seq(usize begin, usize end) const
+    {
+        return RangeIter<I>(static_cast<I>(this->first + begin),
+                            static_cast<I>(this->first + end));
+    }
+};
+
+namespace detail {
+/**
+ * @see ParIter::map
+ */
+template<typename Inner, typename F>
+class ParMap : public ParIter<ParMap<Inner, F>>
+{
+  private:
+    Inner inner;
+    F     func;
+
+  public:
+    ParMap(Inner inner, F func)
+        : inner(std::move(inner))
+        , func(std::move(func))
+    {
+    }
+
+    inline usize len() const { return this->inner.len(); }
+
+    inline auto seq(usize begin, usize end) const
+    {
+        return this->inner.seq(begin, end).map(
+            [func = &this->func](auto &&item) -> decltype(auto) {
+                return (*func)(std::forward<decltype(item)>(item));
+            });
+    }
+};
+
+/**
+ * @see ParIter::filter
+ */
+template<typename Inner, typename P>
+class ParFilter : public ParIter<ParFilter<Inner, P>>
+{
+  private:
+    Inner inner;
+    P     predicate;
+
+  public:
+    ParFilter(Inner inner, P predicate)
+        : inner(std::move(inner))
+        , predicate(std::move(predicate))
+    {
+    }
+
+    inline usize len() const { return this->inner.len(); }
+
+    inline auto seq(usize begin, usize end) const
+    {
+        return this->inner.seq(begin, end).filter(
+            [predicate = &this->predicate](auto &item) {
+                return (*predicate)(item);
+            });
+    }
+};
+}
+
+/**
+ * @brief Parallel iterator over `len` contiguous `T`s at `data`.
+ */
+template<typename T>
+inline ParSlice<T> par_iter(T *data, usize len)
+{
+    return ParSlice<T>(data, len);
+}
+
+/**
+ * @brief Parallel iterator over a contiguous container, yielding references
+ * to its elements.
+ */
+template<typename C>
+inline auto par_iter(C &container)
+{
+    return par_iter(std::data(container), std::size(container));
+}
+
+/**
+ * @brief Parallel iterator over the integers in [begin, end).
+ */
+template<typename I>
+inline ParRange<I> par_range(I begin, I end)
+{
+    return ParRange<I>(begin, end);
+}
+}
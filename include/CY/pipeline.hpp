@@ -0,0 +1,841 @@
+/**
+ * @file pipeline.hpp
+ * @author Jesús Blanco
+ * @brief Streaming pipelines of fallible stages on their own threads, joined
+ * by bounded queues (`Pipeline`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "instant.hpp"
+#include "safety.hpp"
+#include "spsc_queue.hpp"
+#include "thread_pool.hpp"
+#include "types.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cy {
+struct PipelineOptions
+{
+    /// @brief Items a stage hands to the next one at a time. The source hands
+    /// off a partial batch only when it ends or, if it was made by
+    /// `Pipeline::from_poll`, when it has nothing ready. So a `Pipeline::from`
+    /// source that blocks waiting for items holds back up to `batch - 1` of
+    /// them in the meantime.
+    usize batch = 64;
+    /// @brief Batches a queue holds before the stage feeding it waits.
+    usize capacity = 16;
+};
+
+/**
+ * @brief An item a stage failed on: the `Err` it returned, and where.
+ */
+template<typename E>
+struct DeadLetter
+{
+    /// @brief Index of the stage, the source being 0.
+    usize   stage;
+    strview stage_name;
+    E       error;
+};
+
+/**
+ * @brief What a stage of a `Pipeline` did so far.
+ */
+struct StageMetrics
+{
+    strview name;
+    uint64  items_in;
+    /// @brief Items handed to the next stage (those which didn't fail).
+    uint64 items_out;
+    uint64 errors;
+    /// @brief Items waiting for the stage, and the most there ever were (0
+    /// for the source).
+    usize queue_depth;
+    usize max_queue_depth;
+    /// @brief Time spent in the stage's function.
+    Duration busy;
+    /// @brief Time since the pipeline started, or that it ran for.
+    Duration elapsed;
+
+    /**
+     * @brief Items taken in per second.
+     */
+    inline float64 throughput() const
+    {
+        float64 secs = this->elapsed.as_secs_f64();
+        return secs > 0 ? static_cast<float64>(this->items_in) / secs : 0;
+    }
+};
+
+template<typename E>
+class Pipeline;
+
+template<typename E, typename T>
+class PipelineBuilder;
+
+namespace detail {
+/**
+ * @brief Where the one thread waiting on one side of a queue sleeps: it spins
+ * a little, then parks on an `IdleWord` after saying so, and the other side
+ * only makes the futex call when someone is parked.
+ */
+class PipelineSignal
+{
+  private:
+    static constexpr usize SPINS = 32;
+
+    IdleWord          word;
+    std::atomic<bool> waiting{ false };
+
+  public:
+    template<typename Ready>
+    void wait_until(Ready &&ready)
+    {
+        for (usize spin = 0; spin < SPINS; spin++) {
+            if (ready())
+                return;
+
+            std::this_thread::yield();
+        }
+
+        while (!ready()) {
+            uint32 seen = this->word.load();
+            this->waiting.store(true, std::memory_order_relaxed);
+            // Pairs with the fence in notify: either this sees the other
+            // side's change, or the other side sees `waiting`.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (ready()) {
+                this->waiting.store(false, std::memory_order_relaxed);
+                return;
+            }
+
+            this->word.wait(seen);
+            this->waiting.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    void notify()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (this->waiting.load(std::memory_order_relaxed))
+            this->word.notify(false);
+    }
+};
+
+class PipelineChannelBase
+{
+  public:
+    /// @brief Items pushed and not popped yet.
+    std::atomic<usize> depth{ 0 };
+    std::atomic<usize> max_depth{ 0 };
+
+    virtual ~PipelineChannelBase() = default;
+};
+
+/**
+ * @brief The queue between two stages: batches of items, with the producer
+ * waiting while it is full and the consumer while it is empty.
+ */
+template<typename T>
+class PipelineChannel : public PipelineChannelBase
+{
+  private:
+    SpscQueue<std::vector<T>> queue;
+    PipelineSignal            items;
+    PipelineSignal            space;
+    std::atomic<bool>         closed{ false };
+
+  public:
+    explicit PipelineChannel(usize capacity)
+        : queue(capacity)
+    {
+    }
+
+    void push(std::vector<T> &&batch)
+    {
+        usize depth = this->depth.fetch_add(batch.size()) + batch.size();
+        if (depth > this->max_depth.load(std::memory_order_relaxed))
+            this->max_depth.store(depth, std::memory_order_relaxed);
+
+        this->space.wait_until(
+            [&]() { return this->queue.try_push(std::move(batch)); });
+        this->items.notify();
+    }
+
+    /**
+     * @brief The next batch, or `None` once the channel is closed and empty.
+     */
+    Maybe<std::vector<T>> pop()
+    {
+        Maybe<std::vector<T>> batch;
+        this->items.wait_until([&]() {
+            batch = this->queue.try_pop();
+            return batch.is_some() ||
+                   this->closed.load(std::memory_order_acquire);
+        });
+
+        // Closed: take what was pushed before closing.
+        if (batch.is_none())
+            batch = this->queue.try_pop();
+        if (batch.is_none())
+            return None();
+
+        this->depth.fetch_sub(batch.get().size());
+        this->space.notify();
+        return batch;
+    }
+
+    void close()
+    {
+        this->closed.store(true, std::memory_order_release);
+        this->items.notify();
+    }
+};
+
+/**
+ * @brief What the stages of a pipeline share, on the heap so the `Pipeline`
+ * can be moved.
+ */
+template<typename E>
+struct PipelineState
+{
+    std::atomic<bool>                  stopping{ false };
+    std::mutex                         lock;
+    std::exception_ptr                 panic;
+    std::function<void(DeadLetter<E>)> on_dead_letter;
+    std::vector<DeadLetter<E>>         dead_letters;
+    Instant                            started = Instant::now();
+    std::atomic<uint64>                finished_nanos{ 0 };
+
+    void dead_letter(usize stage, strview name, E error)
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        DeadLetter<E>               letter{ stage, name, std::move(error) };
+        if (this->on_dead_letter)
+            this->on_dead_letter(std::move(letter));
+        else
+            this->dead_letters.push_back(std::move(letter));
+    }
+
+    void fail(std::exception_ptr exception)
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        if (!this->panic)
+            this->panic = exception;
+
+        this->stopping.store(true);
+    }
+};
+
+template<typename E>
+class PipelineStage
+{
+  public:
+    std::string          name;
+    usize                index = 0;
+    PipelineChannelBase *input = nullptr;
+
+    std::atomic<uint64> items_in{ 0 };
+    std::atomic<uint64> items_out{ 0 };
+    std::atomic<uint64> errors{ 0 };
+    std::atomic<uint64> busy_nanos{ 0 };
+
+    virtual ~PipelineStage() = default;
+
+    /**
+     * @brief Takes every item in, until the input closes, then closes the
+     * output.
+     */
+    virtual void run(PipelineState<E> &state) = 0;
+
+    /**
+     * @brief After `run` threw: throws the rest of the input away, so the
+     * stages before it don't wait for room forever, and closes the output.
+     */
+    virtual void abort() = 0;
+
+    void record(uint64 in, uint64 out, uint64 failed, Instant start)
+    {
+        this->busy_nanos.fetch_add(start.elapsed().as_nanos(),
+                                   std::memory_order_relaxed);
+        this->items_in.fetch_add(in, std::memory_order_relaxed);
+        this->items_out.fetch_add(out, std::memory_order_relaxed);
+        this->errors.fetch_add(failed, std::memory_order_relaxed);
+    }
+};
+
+/**
+ * @brief The first stage: calls `func` for items until it returns `None`.
+ * With `POLL`, `func` returns `Maybe<Maybe<T>>`, and `Some(None)` means that
+ * nothing is ready yet, which hands off the items gathered so far.
+ */
+template<typename E, typename T, typename F, bool POLL = false>
+class PipelineSource : public PipelineStage<E>
+{
+  private:
+    F                   func;
+    PipelineChannel<T> *output;
+    usize               batch;
+
+  public:
+    PipelineSource(F func, PipelineChannel<T> *output, usize batch)
+        : func(std::move(func))
+        , output(output)
+        , batch(batch)
+    {
+    }
+
+    void run(PipelineState<E> &state) override
+    {
+        bool more = true;
+        while (more && !state.stopping.load(std::memory_order_relaxed)) {
+            std::vector<T> items;
+            items.reserve(this->batch);
+
+            Instant start = Instant::now();
+            while (items.size() < this->batch) {
+                auto item = this->func();
+                if (item.is_none()) {
+                    more = false;
+                    break;
+                }
+
+                if constexpr (POLL) {
+                    Maybe<T> ready = item.unwrap();
+                    if (ready.is_none())
+                        break;
+
+                    items.push_back(ready.unwrap());
+                } else {
+                    items.push_back(item.unwrap());
+                }
+            }
+
+            this->record(items.size(), items.size(), 0, start);
+            if (!items.empty())
+                this->output->push(std::move(items));
+        }
+
+        this->output->close();
+    }
+
+    void abort() override { this->output->close(); }
+};
+
+/**
+ * @brief A stage calling `func` on each item, handing its `Ok` values to the
+ * next stage (unless `U` is `void`: the sink).
+ */
+template<typename E, typename T, typename U, typename F>
+class PipelineMap : public PipelineStage<E>
+{
+  private:
+    F                   func;
+    PipelineChannel<T> *source;
+    PipelineChannel<U> *output;
+
+  public:
+    PipelineMap(F func, PipelineChannel<T> *source, PipelineChannel<U> *output)
+        : func(std::move(func))
+        , source(source)
+        , output(output)
+    {
+        this->input = source;
+    }
+
+    void run(PipelineState<E> &state) override
+    {
+        for (auto batch = this->source->pop(); batch.is_some();
+             batch = this->source->pop()) {
+            std::vector<T> items = batch.unwrap();
+            if (state.stopping.load(std::memory_order_relaxed))
+                continue;
+
+            Instant        start = Instant::now();
+            std::vector<U> out;
+            uint64         failed = 0;
+            out.reserve(items.size());
+
+            for (T &item : items) {
+                Result<U, E> result = this->func(std::move(item));
+                if (result.is_ok()) {
+                    out.push_back(result.unwrap());
+                } else {
+                    failed++;
+                    state.dead_letter(
+                        this->index, this->name, result.unwrap_err());
+                }
+            }
+
+            this->record(items.size(), out.size(), failed, start);
+            if (!out.empty())
+                this->output->push(std::move(out));
+        }
+
+        this->output->close();
+    }
+
+    void abort() override
+    {
+        while (this->source->pop().is_some()) {
+        }
+
+        this->output->close();
+    }
+};
+
+template<typename E, typename T, typename F>
+class PipelineMap<E, T, void, F> : public PipelineStage<E>
+{
+  private:
+    F                   func;
+    PipelineChannel<T> *source;
+
+  public:
+    PipelineMap(F func, PipelineChannel<T> *source, PipelineChannel<void> *)
+        : func(std::move(func))
+        , source(source)
+    {
+        this->input = source;
+    }
+
+    void run(PipelineState<E> &state) override
+    {
+        for (auto batch = this->source->pop(); batch.is_some();
+             batch = this->source->pop()) {
+            std::vector<T> items = batch.unwrap();
+            if (state.stopping.load(std::memory_order_relaxed))
+                continue;
+
+            Instant start = Instant::now();
+            uint64  failed = 0;
+
+            for (T &item : items) {
+                Result<void, E> result = this->func(std::move(item));
+                if (result.is_err()) {
+                    failed++;
+                    state.dead_letter(
+                        this->index, this->name, result.unwrap_err());
+                }
+            }
+
+            this->record(items.size(), items.size() - failed, failed, start);
+        }
+    }
+
+    void abort() override
+    {
+        while (this->source->pop().is_some()) {
+        }
+    }
+};
+}
+
+/**
+ * @brief A chain of stages, each on its own thread, handing items to the next
+ * through a bounded lock-free `SpscQueue`: a source producing items, any
+ * number of stages mapping each item to a `Result<U, E>`, and a sink taking
+ * the last values (`Result<void, E>`).
+ *
+ * `Ok` values flow downstream; `Err`s go to the dead-letter sink along with
+ * the stage they came from, and the pipeline goes on. Items move in batches
+ * of `PipelineOptions::batch`, so stages synchronize once per batch rather
+ * than once per item; a stage whose output queue is full waits for room
+ * (backpressure), parking on a futex after spinning briefly.
+ *
+ * @code
+ * auto pipeline =
+ *     cy::Pipeline<Error>::from("read", [&]() { return lines.next(); })
+ *         .stage("parse", [](std::string line) { return parse(line); })
+ *         .stage("enrich", [&](Record record) { return enrich(record); })
+ *         .sink("write", [&](Record record) { return write(record); });
+ *
+ * pipeline.run();
+ * for (auto &letter : pipeline.take_dead_letters())
+ *     log(letter.stage_name, letter.error);
+ * @endcode
+ */
+template<typename E>
+class Pipeline
+{
+  private:
+    std::unique_ptr<detail::PipelineState<E>>                 state;
+    std::vector<std::unique_ptr<detail::PipelineStage<E>>>    stages;
+    std::vector<std::unique_ptr<detail::PipelineChannelBase>> channels;
+    PipelineOptions                                           options;
+    std::vector<std::thread>                                  threads;
+    std::vector<JoinHandle<void>>                             handles;
+    bool                                                      started = false;
+
+    template<typename, typename>
+    friend class PipelineBuilder;
+
+    explicit Pipeline(PipelineOptions options)
+        : state(std::make_unique<detail::PipelineState<E>>())
+        , options(options)
+    {
+        if (options.batch == 0 || options.capacity == 0)
+            throw std::invalid_argument("Invalid options for Pipeline");
+    }
+
+    template<typename T>
+    detail::PipelineChannel<T> *add_channel()
+    {
+        if constexpr (std::is_void_v<T>) {
+            return nullptr;
+        } else {
+            auto channel =
+                std::make_unique<detail::PipelineChannel<T>>(
+                    this->options.capacity);
+            auto *raw = channel.get();
+            this->channels.push_back(std::move(channel));
+            return raw;
+        }
+    }
+
+    void add_stage(std::string                              name,
+                   std::unique_ptr<detail::PipelineStage<E>> stage)
+    {
+        stage->name = std::move(name);
+        stage->index = this->stages.size();
+        this->stages.push_back(std::move(stage));
+    }
+
+    static void run_stage(detail::PipelineState<E> *state,
+                          detail::PipelineStage<E> *stage)
+    {
+        try {
+            stage->run(*state);
+        } catch (...) {
+            state->fail(std::current_exception());
+            stage->abort();
+        }
+    }
+
+    void begin()
+    {
+        if (this->started)
+            throw std::runtime_error("Called .start() on a started Pipeline");
+
+        this->started = true;
+        this->state->started = Instant::now();
+    }
+
+    /**
+     * @brief Waits for every stage without rethrowing.
+     */
+    void wait()
+    {
+        for (auto &thread : this->threads)
+            thread.join();
+        for (auto &handle : this->handles)
+            (void)handle.join();
+
+        if (this->started && this->state->finished_nanos.load() == 0) {
+            this->state->finished_nanos.store(std::max<uint64>(
+                this->state->started.elapsed().as_nanos(), 1));
+        }
+
+        this->threads.clear();
+        this->handles.clear();
+    }
+
+  public:
+    Pipeline(Pipeline &&) = default;
+    Pipeline &operator=(Pipeline &&) = delete;
+
+    /**
+     * @brief Stops a pipeline still running (every stage drops what it has
+     * left) and waits for it.
+     */
+    ~Pipeline()
+    {
+        if (this->state == nullptr)
+            return;
+
+        this->state->stopping.store(true);
+        this->wait();
+    }
+
+    /**
+     * @brief Starts a pipeline whose items come from `source`, a function
+     * returning `Maybe<T>` (`None` once there are no more). Add stages to the
+     * builder it returns, and end it with a sink.
+     *
+     * @exception std::invalid_argument Thrown if an option is 0.
+     */
+    template<typename F>
+    static PipelineBuilder<
+        E,
+        typename detail::MaybeTraits<std::invoke_result_t<std::decay_t<F> &>>::
+            Value>
+    from(std::string name, F &&source, PipelineOptions options = {})
+    {
+        using T = typename detail::MaybeTraits<
+            std::invoke_result_t<std::decay_t<F> &>>::Value;
+
+        Pipeline pipeline(options);
+        auto    *output = pipeline.template add_channel<T>();
+        pipeline.add_stage(
+            std::move(name),
+            std::make_unique<detail::PipelineSource<E, T, std::decay_t<F>>>(
+                std::forward<F>(source), output, options.batch));
+
+        return PipelineBuilder<E, T>(std::move(pipeline), output);
+    }
+
+    /**
+     * @brief Like `from`, for a source that may have nothing ready: `source`
+     * returns `Maybe<Maybe<T>>`, `Some(None)` when no item is ready yet and
+     * `None` once there are no more. Items gathered so far are handed on as
+     * soon as it has nothing ready, rather than waiting for a full batch.
+     *
+     * `source` is called again right away, so it should wait a little
+     * (e.g. on its own queue, with a timeout) before saying nothing is ready.
+     *
+     * @exception std::invalid_argument Thrown if an option is 0.
+     */
+    template<typename F>
+    static PipelineBuilder<
+        E,
+        typename detail::MaybeTraits<typename detail::MaybeTraits<
+            std::invoke_result_t<std::decay_t<F> &>>::Value>::Value>
+    from_poll(std::string name, F &&source, PipelineOptions options = {})
+    {
+        using T = typename detail::MaybeTraits<typename detail::MaybeTraits<
+            std::invoke_result_t<std::decay_t<F> &>>::Value>::Value;
+
+        Pipeline pipeline(options);
+        auto    *output = pipeline.template add_channel<T>();
+        pipeline.add_stage(
+            std::move(name),
+            std::make_unique<
+                detail::PipelineSource<E, T, std::decay_t<F>, true>>(
+                std::forward<F>(source), output, options.batch));
+
+        return PipelineBuilder<E, T>(std::move(pipeline), output);
+    }
+
+    /**
+     * @brief Sends dead letters to `func` (one call at a time, from the
+     * threads of the stages) instead of keeping them for
+     * `take_dead_letters()`.
+     */
+    template<typename F>
+    void on_dead_letter(F &&func)
+    {
+        if (this->started)
+            throw std::runtime_error("Called .on_dead_letter() while running");
+
+        this->state->on_dead_letter = std::forward<F>(func);
+    }
+
+    /**
+     * @brief Number of stages, the source and the sink included.
+     */
+    inline usize len() const { return this->stages.size(); }
+
+    /**
+     * @brief Starts every stage on a thread of its own.
+     *
+     * @exception std::runtime_error Thrown if the pipeline was started before.
+     */
+    void start()
+    {
+        this->begin();
+
+        auto *state = this->state.get();
+        for (auto &stage : this->stages) {
+            this->threads.emplace_back(
+                [state, raw = stage.get()]() { run_stage(state, raw); });
+        }
+    }
+
+    /**
+     * @brief Starts every stage as a job of `pool`, which each keeps for as
+     * long as the pipeline runs.
+     *
+     * @exception std::invalid_argument Thrown if `pool` has fewer workers than
+     * the pipeline has stages, since they would wait on each other forever.
+     * @exception std::runtime_error Thrown if the pipeline was started before.
+     */
+    void start(ThreadPool &pool)
+    {
+        if (pool.size() < this->stages.size())
+            throw std::invalid_argument("Not enough workers for the Pipeline");
+
+        this->begin();
+
+        auto *state = this->state.get();
+        for (auto &stage : this->stages) {
+            this->handles.push_back(pool.spawn(
+                [state, raw = stage.get()]() { run_stage(state, raw); }));
+        }
+    }
+
+    /**
+     * @brief Waits for every stage to finish.
+     *
+     * @exception ... Whatever a stage (or the dead-letter sink) threw, the
+     * first one to. The pipeline then stops: the source takes no more items,
+     * and every stage drops what it has left.
+     */
+    void join()
+    {
+        this->wait();
+
+        if (this->state->panic)
+            std::rethrow_exception(this->state->panic);
+    }
+
+    /**
+     * @brief Starts the pipeline on threads of its own, and waits for it.
+     */
+    void run()
+    {
+        this->start();
+        this->join();
+    }
+
+    /**
+     * @brief Starts the pipeline on `pool`, and waits for it.
+     */
+    void run(ThreadPool &pool)
+    {
+        this->start(pool);
+        this->join();
+    }
+
+    /**
+     * @brief The metrics of each stage, from the source to the sink. Can be
+     * called while the pipeline runs.
+     */
+    std::vector<StageMetrics> metrics() const
+    {
+        uint64   finished = this->state->finished_nanos.load();
+        Duration elapsed =
+            finished != 0 ? Duration::from_nanos(finished)
+            : this->started ? this->state->started.elapsed()
+                            : Duration();
+
+        std::vector<StageMetrics> out;
+        for (auto const &stage : this->stages) {
+            auto const *input = stage->input;
+            out.push_back(StageMetrics{
+                stage->name,
+                stage->items_in.load(std::memory_order_relaxed),
+                stage->items_out.load(std::memory_order_relaxed),
+                stage->errors.load(std::memory_order_relaxed),
+                input != nullptr ? input->depth.load() : 0,
+                input != nullptr ? input->max_depth.load() : 0,
+                Duration::from_nanos(
+                    stage->busy_nanos.load(std::memory_order_relaxed)),
+                elapsed });
+        }
+
+        return out;
+    }
+
+    /**
+     * @brief Moves out the dead letters kept so far (none if they go to an
+     * `on_dead_letter` function). `stage_name` is valid while the pipeline
+     * lives.
+     */
+    std::vector<DeadLetter<E>> take_dead_letters()
+    {
+        std::lock_guard<std::mutex> guard(this->state->lock);
+        return std::move(this->state->dead_letters);
+    }
+};
+
+/**
+ * @brief A `Pipeline` being built, whose last stage gives out `T`s.
+ */
+template<typename E, typename T>
+class PipelineBuilder
+{
+  private:
+    Pipeline<E>                 pipeline;
+    detail::PipelineChannel<T> *tail;
+
+    template<typename, typename>
+    friend class PipelineBuilder;
+    friend class Pipeline<E>;
+
+    PipelineBuilder(Pipeline<E> &&pipeline, detail::PipelineChannel<T> *tail)
+        : pipeline(std::move(pipeline))
+        , tail(tail)
+    {
+    }
+
+    template<typename F>
+    using Output = detail::ResultTraits<std::invoke_result_t<
+        std::decay_t<F> &,
+        std::add_rvalue_reference_t<T>>>;
+
+    template<typename U, typename F>
+    PipelineBuilder<E, U> then(std::string name, F &&func)
+    {
+        static_assert(std::is_same_v<typename Output<F>::Error, E>,
+                      "Stages must return a Result with the pipeline's error "
+                      "type.");
+
+        auto *output = this->pipeline.template add_channel<U>();
+        this->pipeline.add_stage(
+            std::move(name),
+            std::make_unique<
+                detail::PipelineMap<E, T, U, std::decay_t<F>>>(
+                std::forward<F>(func), this->tail, output));
+
+        return PipelineBuilder<E, U>(std::move(this->pipeline), output);
+    }
+
+  public:
+    /**
+     * @brief Adds a stage mapping each item to a `Result<U, E>`.
+     */
+    template<typename F>
+    PipelineBuilder<E, typename Output<F>::Value> stage(std::string name,
+                                                        F         &&func)
+    {
+        static_assert(!std::is_void_v<typename Output<F>::Value>,
+                      "A stage returning Result<void, E> is a sink.");
+
+        return this->template then<typename Output<F>::Value>(
+            std::move(name), std::forward<F>(func));
+    }
+
+    /**
+     * @brief Ends the pipeline with a stage taking each item, returning
+     * `Result<void, E>`.
+     */
+    template<typename F>
+    Pipeline<E> sink(std::string name, F &&func)
+    {
+        static_assert(std::is_void_v<typename Output<F>::Value>,
+                      "A sink returns Result<void, E>.");
+
+        return std::move(
+            this->template then<void>(std::move(name), std::forward<F>(func))
+                .pipeline);
+    }
+};
+}
@@ -0,0 +1,391 @@
+/**
+ * @file rc.hpp
+ * @author Jesús Blanco
+ * @brief Reference counted shared pointers (`Rc<T>` and `Arc<T>`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "safety.hpp"
+#include "types.hpp"
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+namespace cy {
+namespace detail {
+/**
+ * @brief Plain reference count, for pointers that never leave their thread.
+ */
+class LocalCount
+{
+  private:
+    usize n;
+
+  public:
+    explicit LocalCount(usize n)
+        : n(n)
+    {
+    }
+
+    inline usize load() const { return this->n; }
+    inline void  increment() { this->n++; }
+    /**
+     * @brief Returns true if this was the last reference.
+     */
+    inline bool decrement() { return --this->n == 0; }
+    /**
+     * @brief Increments the count unless it already hit zero.
+     */
+    inline bool increment_if_alive()
+    {
+        if (this->n == 0)
+            return false;
+
+        this->n++;
+        return true;
+    }
+};
+
+/**
+ * @brief Atomic reference count, for pointers shared between threads.
+ */
+class AtomicCount
+{
+  private:
+    std::atomic<usize> n;
+
+  public:
+    explicit AtomicCount(usize n)
+        : n(n)
+    {
+    }
+
+    inline usize load() const
+    {
+        return this->n.load(std::memory_order_acquire);
+    }
+    inline void increment() { this->n.fetch_add(1, std::memory_order_relaxed); }
+    /**
+     * @brief Returns true if this was the last reference.
+     */
+    inline bool decrement()
+    {
+        if (this->n.fetch_sub(1, std::memory_order_release) != 1)
+            return false;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return true;
+    }
+    /**
+     * @brief Increments the count unless it already hit zero.
+     */
+    inline bool increment_if_alive()
+    {
+        usize current = this->n.load(std::memory_order_relaxed);
+
+        while (current != 0) {
+            if (this->n.compare_exchange_weak(current,
+                                              current + 1,
+                                              std::memory_order_acquire,
+                                              std::memory_order_relaxed))
+                return true;
+        }
+
+        return false;
+    }
+};
+
+/**
+ * @brief The single allocation behind a shared pointer: both counts followed
+ * by the value. All strong references together hold one weak reference, so
+ * the block outlives the value while there are weak references around.
+ */
+template<typename T, typename Count>
+struct SharedBlock
+{
+    Count strong;
+    Count weak;
+    union
+    {
+        T value;
+    };
+
+    template<typename... Args>
+    explicit SharedBlock(Args &&...args)
+        : strong(1)
+        , weak(1)
+        , value(std::forward<Args>(args)...)
+    {
+    }
+
+    ~SharedBlock() {}
+};
+
+template<typename T, typename Count>
+class Weak;
+
+/**
+ * @brief A shared pointer to a `T` living in a single allocation with its
+ * reference counts. Use it through `Rc<T>` or `Arc<T>`.
+ *
+ * It is never null, except when moved-from. That state is declared as its
+ * niche, so `Maybe<Rc<T>>` is the size of a pointer.
+ */
+template<typename T, typename Count>
+class Shared
+{
+    static_assert(!std::is_void_v<T>, "Rc<void> is invalid.");
+
+  private:
+    using Block = SharedBlock<T, Count>;
+
+    Block *block;
+
+    explicit Shared(Block *block)
+        : block(block)
+    {
+    }
+
+    void release()
+    {
+        if (this->block == nullptr || !this->block->strong.decrement())
+            return;
+
+        this->block->value.~T();
+        if (this->block->weak.decrement())
+            delete this->block;
+    }
+
+  public:
+    friend Weak<T, Count>;
+    friend Niche<Shared<T, Count>>;
+
+    template<typename U, typename C, typename... Args>
+    friend Shared<U, C> make_shared_block(Args &&...args);
+
+    ~Shared() { this->release(); }
+
+    Shared(Shared const &other)
+        : block(other.block)
+    {
+        // Null when `other` is moved-from, or a `None` of `Maybe<Rc<T>>`.
+        if (this->block != nullptr)
+            this->block->strong.increment();
+    }
+
+    Shared(Shared &&other) noexcept
+        : block(std::exchange(other.block, nullptr))
+    {
+    }
+
+    Shared &operator=(Shared const &other)
+    {
+        Shared copy(other);
+        std::swap(this->block, copy.block);
+        return *this;
+    }
+
+    Shared &operator=(Shared &&other) noexcept
+    {
+        if (this != &other) {
+            this->release();
+            this->block = std::exchange(other.block, nullptr);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Gets a const reference to `T` (`T const&`).
+     */
+    inline T const &get() const { return this->block->value; }
+    /**
+     * @brief Gets a reference to `T` (`T&`).
+     */
+    inline T &get() { return this->block->value; }
+
+    inline T const &operator*() const { return this->block->value; }
+    inline T       &operator*() { return this->block->value; }
+    inline T const *operator->() const { return &this->block->value; }
+    inline T       *operator->() { return &this->block->value; }
+
+    /**
+     * @brief Creates a weak reference to the same value.
+     */
+    Weak<T, Count> downgrade() const
+    {
+        this->block->weak.increment();
+        return Weak<T, Count>(this->block);
+    }
+
+    /**
+     * @brief Number of strong references to the value.
+     */
+    inline usize strong_count() const { return this->block->strong.load(); }
+    /**
+     * @brief Number of weak references to the value.
+     */
+    inline usize weak_count() const { return this->block->weak.load() - 1; }
+
+    /**
+     * @brief Whether both pointers point to the same allocation.
+     */
+    inline bool ptr_eq(Shared const &other) const
+    {
+        return this->block == other.block;
+    }
+};
+
+/**
+ * @brief A non-owning reference to a value held by `Shared<T, Count>`. It keeps
+ * the allocation, but not the value, alive.
+ */
+template<typename T, typename Count>
+class Weak
+{
+  private:
+    using Block = SharedBlock<T, Count>;
+
+    Block *block;
+
+    explicit Weak(Block *block)
+        : block(block)
+    {
+    }
+
+    void release()
+    {
+        if (this->block != nullptr && this->block->weak.decrement())
+            delete this->block;
+    }
+
+  public:
+    friend Shared<T, Count>;
+
+    ~Weak() { this->release(); }
+
+    Weak(Weak const &other)
+        : block(other.block)
+    {
+        if (this->block != nullptr)
+            this->block->weak.increment();
+    }
+
+    Weak(Weak &&other) noexcept
+        : block(std::exchange(other.block, nullptr))
+    {
+    }
+
+    Weak &operator=(Weak const &other)
+    {
+        Weak copy(other);
+        std::swap(this->block, copy.block);
+        return *this;
+    }
+
+    Weak &operator=(Weak &&other) noexcept
+    {
+        if (this != &other) {
+            this->release();
+            this->block = std::exchange(other.block, nullptr);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Gets a strong reference to the value, if it's still alive (and
+     * `None` if this `Weak` was moved-from).
+     */
+    Maybe<Shared<T, Count>> upgrade() const
+    {
+        if (this->block == nullptr ||
+            !this->block->strong.increment_if_alive())
+            return None();
+
+        return Some(Shared<T, Count>(this->block));
+    }
+
+    /**
+     * @brief Number of strong references to the value.
+     */
+    inline usize strong_count() const { return this->block->strong.load(); }
+};
+
+template<typename T, typename Count, typename... Args>
+Shared<T, Count> make_shared_block(Args &&...args)
+{
+    return Shared<T, Count>(
+        new SharedBlock<T, Count>(std::forward<Args>(args)...));
+}
+}
+
+/**
+ * @brief A single-threaded reference counted pointer. Its counts are not
+ * atomic, so it must not be shared between threads.
+ */
+template<typename T>
+using Rc = detail::Shared<T, detail::LocalCount>;
+/**
+ * @brief A weak reference to the value of an `Rc<T>`.
+ */
+template<typename T>
+using WeakRc = detail::Weak<T, detail::LocalCount>;
+
+/**
+ * @brief An atomically reference counted pointer, safe to share between
+ * threads. Only the counts are synchronized, not `T`.
+ */
+template<typename T>
+using Arc = detail::Shared<T, detail::AtomicCount>;
+/**
+ * @brief A weak reference to the value of an `Arc<T>`.
+ */
+template<typename T>
+using WeakArc = detail::Weak<T, detail::AtomicCount>;
+
+/**
+ * @brief Constructs a `T` into a new `Rc<T>`, with a single allocation.
+ */
+template<typename T, typename... Args>
+Rc<T> make_rc(Args &&...args)
+{
+    return detail::make_shared_block<T, detail::LocalCount>(
+        std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Constructs a `T` into a new `Arc<T>`, with a single allocation.
+ */
+template<typename T, typename... Args>
+Arc<T> make_arc(Args &&...args)
+{
+    return detail::make_shared_block<T, detail::AtomicCount>(
+        std::forward<Args>(args)...);
+}
+
+/**
+ * @brief The niche of `Rc<T>` and `Arc<T>` is the null pointer, which is also
+ * their moved-from state.
+ */
+template<typename T, typename Count>
+struct Niche<detail::Shared<T, Count>>
+{
+    static constexpr bool value = true;
+
+    static detail::Shared<T, Count> none()
+    {
+        return detail::Shared<T, Count>(nullptr);
+    }
+    static bool is_none(detail::Shared<T, Count> const &shared)
+    {
+        return shared.block == nullptr;
+    }
+};
+}
@@ -13,6 +13,8 @@
 
 #include <algorithm>
 #include <functional>
+#include <memory>
+#include <new>
 #include <stdexcept>
 #include <type_traits>
 namespace cy {
@@ -66,49 +68,266 @@ class None
 };
 
 /**
- * @brief `Maybe<T>` represents a value that might or might not exist. If it's
- * `Some<T>`, then the value exists. If it is `None`, then it does not exist.
+ * @brief Describes the niche of `T`: a state that a valid `T` never holds,
+ * which `Maybe<T>` can use to represent `None` instead of storing a separate
+ * flag. Types opt in by specializing it with `value = true`, a static `none()`
+ * returning `T` in that state, and a static `is_none(T const&)` predicate.
+ *
+ * @attention The niche state must be safe to destroy. For owning types it
+ * should also be their moved-from state, so unwrapping a `Maybe<T>` leaves it
+ * as `None`.
  */
 template<typename T>
-class Maybe
+struct Niche
 {
-    static_assert(!std::is_void_v<T>, "Maybe<void> is invalid.");
+    static constexpr bool value = false;
+};
 
-  private:
+namespace detail {
+enum class MaybeKind
+{
+    Flagged,
+    Trivial,
+    Niche,
+};
+
+template<typename T>
+constexpr MaybeKind maybe_kind_v =
+    Niche<T>::value ? MaybeKind::Niche
+    : std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>
+        ? MaybeKind::Trivial
+        : MaybeKind::Flagged;
+
+/**
+ * @brief Storage for `Maybe<T>` when `T` doesn't have a niche: a flag and the
+ * (possibly uninitialized) value.
+ */
+template<typename T, MaybeKind = maybe_kind_v<T>>
+class MaybeStorage
+{
+  protected:
     bool has_value;
     union
     {
-        T value;
+        char none;
+        T    value;
+    };
+
+    constexpr MaybeStorage()
+        : has_value(false)
+        , none()
+    {
+    }
+
+    constexpr MaybeStorage(T &&val)
+        : has_value(true)
+        , value(std::move(val))
+    {
+    }
+
+    MaybeStorage(MaybeStorage const &other)
+        : has_value(false)
+        , none()
+    {
+        if (other.has_value)
+            this->construct(other.value);
+    }
+
+    MaybeStorage(MaybeStorage &&other) noexcept(
+        std::is_nothrow_move_constructible_v<T>)
+        : has_value(false)
+        , none()
+    {
+        if (other.has_value)
+            this->construct(std::move(other.value));
+    }
+
+    MaybeStorage &operator=(MaybeStorage const &other)
+    {
+        if (this->has_value && other.has_value)
+            this->value = other.value;
+        else if (other.has_value)
+            this->construct(other.value);
+        else
+            this->reset();
+
+        return *this;
+    }
+
+    MaybeStorage &operator=(MaybeStorage &&other) noexcept(
+        std::is_nothrow_move_constructible_v<T> &&
+        std::is_nothrow_move_assignable_v<T>)
+    {
+        if (this->has_value && other.has_value)
+            this->value = std::move(other.value);
+        else if (other.has_value)
+            this->construct(std::move(other.value));
+        else
+            this->reset();
+
+        return *this;
+    }
+
+    ~MaybeStorage() { this->reset(); }
+
+    inline constexpr bool engaged() const { return this->has_value; }
+    inline void           forget() { this->has_value = false; }
+
+    /**
+     * @brief Constructs the value in place. Must be disengaged.
+     */
+    template<typename... Args>
+    inline void construct(Args &&...args)
+    {
+        ::new (static_cast<void *>(std::addressof(this->value)))
+            T(std::forward<Args>(args)...);
+        this->has_value = true;
+    }
+
+    /**
+     * @brief Destroys the value, if any.
+     */
+    inline void reset()
+    {
+        if (this->has_value) {
+            this->value.~T();
+            this->has_value = false;
+        }
+    }
+};
+
+/**
+ * @brief Storage for `Maybe<T>` when `T` is trivially copyable and
+ * destructible, so `Maybe<T>` is as well.
+ */
+template<typename T>
+class MaybeStorage<T, MaybeKind::Trivial>
+{
+  protected:
+    bool has_value;
+    union
+    {
+        char none;
+        T    value;
     };
 
+    constexpr MaybeStorage()
+        : has_value(false)
+        , none()
+    {
+    }
+
+    constexpr MaybeStorage(T &&val)
+        : has_value(true)
+        , value(std::move(val))
+    {
+    }
+
+    inline constexpr bool engaged() const { return this->has_value; }
+    inline void           forget() { this->has_value = false; }
+
+    template<typename... Args>
+    inline void construct(Args &&...args)
+    {
+        ::new (static_cast<void *>(std::addressof(this->value)))
+            T(std::forward<Args>(args)...);
+        this->has_value = true;
+    }
+
+    inline void reset() { this->has_value = false; }
+};
+
+/**
+ * @brief Storage for `Maybe<T>` when `T` has a niche: just a `T`, which is in
+ * its niche state while the `Maybe<T>` is `None`.
+ */
+template<typename T>
+class MaybeStorage<T, MaybeKind::Niche>
+{
+  protected:
+    T value;
+
+    constexpr MaybeStorage()
+        : value(Niche<T>::none())
+    {
+    }
+
+    constexpr MaybeStorage(T &&val)
+        : value(std::move(val))
+    {
+    }
+
+    inline constexpr bool engaged() const
+    {
+        return !Niche<T>::is_none(this->value);
+    }
+    inline void forget() {}
+
+    template<typename... Args>
+    inline void construct(Args &&...args)
+    {
+        this->value = T(std::forward<Args>(args)...);
+    }
+
+    inline void reset() { this->value = Niche<T>::none(); }
+};
+
+/**
+ * @brief Deletes the copy operations of `Maybe<T>` when `T` can't be copied,
+ * so that type traits report it correctly.
+ */
+template<bool Copyable>
+struct CopyControl
+{
+};
+
+template<>
+struct CopyControl<false>
+{
+    CopyControl() = default;
+    CopyControl(CopyControl const &) = delete;
+    CopyControl(CopyControl &&) = default;
+    CopyControl &operator=(CopyControl const &) = delete;
+    CopyControl &operator=(CopyControl &&) = default;
+};
+}
+
+/**
+ * @brief `Maybe<T>` represents a value that might or might not exist. If it's
+ * `Some<T>`, then the value exists. If it is `None`, then it does not exist.
+ *
+ * If `T` declares a niche (see `Niche<T>`), `Maybe<T>` is the same size as `T`.
+ */
+template<typename T>
+class Maybe
+    : private detail::MaybeStorage<T>
+    , private detail::CopyControl<std::is_copy_constructible_v<T> &&
+                                  std::is_copy_assignable_v<T>>
+{
+    static_assert(!std::is_void_v<T>, "Maybe<void> is invalid.");
+
+  private:
     inline T const &get_unchecked() const & { return this->value; }
     inline T       &get_unchecked()       &{ return this->value; }
     inline T      &&unwrap_unchecked()
     {
-        this->has_value = false;
+        this->forget();
         return std::move(this->value);
     }
 
   public:
-    ~Maybe()
-    {
-        if (this->has_value)
-            this->value.~T();
-    }
-
     constexpr Maybe(Some<T> some)
-        : has_value(true)
-        , value(std::move(some.val))
+        : detail::MaybeStorage<T>(std::move(some.val))
     {
     }
 
     constexpr Maybe(None)
-        : has_value(false)
+        : detail::MaybeStorage<T>()
     {
     }
 
     constexpr Maybe()
-        : has_value(false)
+        : detail::MaybeStorage<T>()
     {
     }
 
@@ -118,7 +337,7 @@ class Maybe
      * @return true If it is.
      * @return false If it isn't.
      */
-    inline constexpr bool is_some() const { return this->has_value; }
+    inline constexpr bool is_some() const { return this->engaged(); }
     /**
      * @brief Opposite of `is_some`.
      */
@@ -132,7 +351,7 @@ class Maybe
      */
     constexpr T const &get() const &
     {
-        if (!this->has_value)
+        if (!this->engaged())
             throw std::runtime_error("Called .get() on a none value");
 
         return this->get_unchecked();
@@ -145,7 +364,7 @@ class Maybe
      */
     constexpr T &get() &
     {
-        if (!this->has_value)
+        if (!this->engaged())
             throw std::runtime_error("Called .get() on a none value");
 
         return this->get_unchecked();
@@ -158,12 +377,92 @@ class Maybe
      */
     constexpr T &&unwrap()
     {
-        if (!this->has_value)
+        if (!this->engaged())
             throw std::runtime_error("Called .unwrap() on a none value");
 
         return this->unwrap_unchecked();
     }
 
+    /**
+     * @brief Takes the value out of `Maybe<T>`, leaving `None` in its place.
+     */
+    Maybe<T> take()
+    {
+        Maybe<T> taken;
+
+        if (this->engaged()) {
+            taken.construct(std::move(this->value));
+            this->reset();
+        }
+
+        return taken;
+    }
+
+    /**
+     * @brief Puts `value` in place of the current value (if any), which is
+     * returned. The value is move-assigned, not destroyed and rebuilt.
+     */
+    Maybe<T> replace(T value)
+    {
+        Maybe<T> old;
+
+        if (this->engaged()) {
+            old.construct(std::move(this->value));
+            this->value = std::move(value);
+        } else {
+            this->construct(std::move(value));
+        }
+
+        return old;
+    }
+
+    /**
+     * @brief Puts `value` in place of the current value (if any), dropping
+     * it, and returns a reference to the new value.
+     */
+    T &insert(T value)
+    {
+        if (this->engaged())
+            this->value = std::move(value);
+        else
+            this->construct(std::move(value));
+
+        return this->value;
+    }
+
+    /**
+     * @brief Gets a reference to the value, first inserting the one returned
+     * by `func` if this `Maybe<T>` is `None`.
+     *
+     * @param func Function returning a `T`, only called if needed.
+     */
+    template<typename F>
+    T &get_or_insert_with(F &&func)
+    {
+        if (!this->engaged())
+            this->construct(std::forward<F>(func)());
+
+        return this->value;
+    }
+
+    /**
+     * @brief Swaps the contents of two `Maybe<T>`s. Values are swapped in
+     * place when both are `Some<T>`.
+     */
+    void swap(Maybe &other)
+    {
+        if (this->engaged() && other.engaged()) {
+            using std::swap;
+            swap(this->value, other.value);
+        } else if (this->engaged()) {
+            other.construct(std::move(this->value));
+            this->reset();
+        } else if (other.engaged()) {
+            this->construct(std::move(other.value));
+            other.reset();
+        }
+    }
+
     /**
      * @brief Maps a `Maybe<T>` to a `Maybe<U>` by taking a function that maps
      * `T` to `U` and running it if `Maybe<T>` is `Some<T>`.
@@ -173,7 +472,7 @@ class Maybe
     template<typename U>
     Maybe<U> map(std::function<U(T)> func)
     {
-        if (this->has_value) {
+        if (this->engaged()) {
             return Some(func(this->unwrap_unchecked()));
         }
 
@@ -271,6 +570,20 @@ class Maybe<T &>
      */
     inline constexpr bool is_none() const { return !this->is_some(); }
 
+    /**
+     * @brief Gets the reference in `Maybe<T&>` (`T&`).
+     *
+     * @exception std::runtime_error Thrown if `Maybe<T&>` doesn't actually have
+     * a reference.
+     */
+    constexpr T &get() const
+    {
+        if (!this->has_value)
+            throw std::runtime_error("Called .get() on a none value");
+
+        return *this->value;
+    }
+
     /**
      * @brief Unwraps the reference in `Maybe<T&>`, allowing to move it out.
      *
@@ -285,6 +598,60 @@ class Maybe<T &>
         return this->unwrap_unchecked();
     }
 
+    /**
+     * @brief Takes the reference out of `Maybe<T&>`, leaving `None` in its
+     * place.
+     */
+    Maybe<T &> take()
+    {
+        Maybe<T &> taken = *this;
+        this->has_value = false;
+        return taken;
+    }
+
+    /**
+     * @brief Rebinds this `Maybe<T&>` to `value`, returning the old reference
+     * (if any).
+     */
+    Maybe<T &> replace(T &value)
+    {
+        Maybe<T &> old = *this;
+        this->insert(value);
+        return old;
+    }
+
+    /**
+     * @brief Rebinds this `Maybe<T&>` to `value`.
+     */
+    T &insert(T &value)
+    {
+        this->has_value = true;
+        this->value = &value;
+        return value;
+    }
+
+    /**
+     * @brief Gets the reference, first binding it to the one returned by
+     * `func` if this `Maybe<T&>` is `None`.
+     */
+    template<typename F>
+    T &get_or_insert_with(F &&func)
+    {
+        if (!this->has_value)
+            return this->insert(std::forward<F>(func)());
+
+        return *this->value;
+    }
+
+    /**
+     * @brief Swaps the contents of two `Maybe<T&>`s.
+     */
+    void swap(Maybe &other)
+    {
+        std::swap(this->has_value, other.has_value);
+        std::swap(this->value, other.value);
+    }
+
     /**
      * @brief Maps a `Maybe<T&>` to a `Maybe<U>` by taking a function that maps
      * `T&` to `U` and running it if `Maybe<T&>` is `Some<T&>`.
@@ -302,6 +669,15 @@ class Maybe<T &>
     }
 };
 
+/**
+ * @brief Swaps the contents of two `Maybe<T>`s.
+ */
+template<typename T>
+inline void swap(Maybe<T> &a, Maybe<T> &b)
+{
+    a.swap(b);
+}
+
 /**
  * @brief An Ok value.
  * @ref Result<T, E>
@@ -682,6 +1058,19 @@ class [[nodiscard("Result must be handled.")]] Result<T &, E>
         return this->get_err_unchecked();
     }
 
+    /**
+     * @brief Gets the reference in `Result<T&, E>` (`T&`).
+     *
+     * @exception std::runtime_error Thrown if `Result<T&, E>` doesn't actually
+     * have a reference.
+     */
+    constexpr T &get() const
+    {
+        CHECK_IF_VALID_T(".get()");
+
+        return *this->value;
+    }
+
     /**
      * @brief Unwraps the reference in `Result<T&, E>`, allowing to move it out.
      *
@@ -859,4 +1248,31 @@ class [[nodiscard("Result must be handled.")]] Result<void, E>
         return None();
     }
 };
+
+namespace detail {
+/**
+ * @brief The `T` and `E` of a `Result<T, E>`.
+ */
+template<typename R>
+struct ResultTraits;
+
+template<typename T, typename E>
+struct ResultTraits<Result<T, E>>
+{
+    using Value = T;
+    using Error = E;
+};
+
+/**
+ * @brief The `T` of a `Maybe<T>`.
+ */
+template<typename M>
+struct MaybeTraits;
+
+template<typename T>
+struct MaybeTraits<Maybe<T>>
+{
+    using Value = T;
+};
+}
 }
\ No newline at end of file
@@ -0,0 +1,145 @@
+/**
+ * @file seq_lock.hpp
+ * @author Jesús Blanco
+ * @brief A sequence lock for values read far more often than written
+ * (`SeqLock<T>`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "safety.hpp"
+#include "types.hpp"
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace cy {
+/**
+ * @brief A `T` behind a sequence number, which writers make odd while they
+ * write and even again when done. Readers never write anything shared: they
+ * copy the value and keep the copy if the sequence was even and unchanged
+ * throughout, retrying otherwise. Reads never block writers, and readers
+ * don't slow each other down by bouncing a lock's cache line around.
+ *
+ * The value is kept in relaxed atomic words, so a read racing with a write is
+ * well-defined (the torn copy is just thrown away).
+ *
+ * @attention `T` must be trivially copyable (and default constructible).
+ * Readers retry for as long as writes keep coming, so it suits values written
+ * now and then (a snapshot of prices, a config) much better than counters.
+ */
+template<typename T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "SeqLock needs a trivially copyable type.");
+    static_assert(std::is_default_constructible_v<T>,
+                  "SeqLock copies values out into a default-constructed T.");
+
+  private:
+    static constexpr usize WORDS = (sizeof(T) + 7) / 8;
+
+    std::atomic<uint64> sequence{ 0 };
+    std::atomic<uint64> words[WORDS];
+
+    /**
+     * @brief Copies the value into `out` if no write ran meanwhile.
+     */
+    bool try_copy(T &out) const
+    {
+        uint64 before = this->sequence.load(std::memory_order_acquire);
+        if (before % 2 != 0)
+            return false;
+
+        uint64 buffer[WORDS];
+        for (usize i = 0; i < WORDS; i++)
+            buffer[i] = this->words[i].load(std::memory_order_relaxed);
+
+        // Keeps the loads above from moving after the check below.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (this->sequence.load(std::memory_order_relaxed) != before)
+            return false;
+
+        std::memcpy(&out, buffer, sizeof(T));
+        return true;
+    }
+
+  public:
+    explicit SeqLock(T const &value = T{})
+    {
+        uint64 buffer[WORDS] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+
+        for (usize i = 0; i < WORDS; i++)
+            this->words[i].store(buffer[i], std::memory_order_relaxed);
+    }
+
+    SeqLock(SeqLock const &) = delete;
+    SeqLock &operator=(SeqLock const &) = delete;
+
+    /**
+     * @brief Replaces the value. Concurrent writers take turns, spinning.
+     */
+    void write(T const &value)
+    {
+        uint64 buffer[WORDS] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+
+        uint64 seq = this->sequence.load(std::memory_order_relaxed);
+        while (seq % 2 != 0 ||
+               !this->sequence.compare_exchange_weak(
+                   seq, seq + 1, std::memory_order_acquire)) {
+            std::this_thread::yield();
+            seq = this->sequence.load(std::memory_order_relaxed);
+        }
+
+        // Keeps the stores below from moving before the odd sequence.
+        std::atomic_thread_fence(std::memory_order_release);
+        for (usize i = 0; i < WORDS; i++)
+            this->words[i].store(buffer[i], std::memory_order_relaxed);
+
+        this->sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Copies the value, retrying until no write gets in the way.
+     */
+    T read() const
+    {
+        T value;
+        while (!this->try_copy(value))
+            std::this_thread::yield();
+
+        return value;
+    }
+
+    /**
+     * @brief Copies the value, giving up with `None` if writes got in the way
+     * of the first try and `max_retries` more.
+     */
+    Maybe<T> try_read(usize max_retries) const
+    {
+        T value;
+        for (usize attempt = 0; attempt <= max_retries; attempt++) {
+            if (this->try_copy(value))
+                return Some(value);
+        }
+
+        return None();
+    }
+
+    /**
+     * @brief Number of writes so far.
+     */
+    inline uint64 version() const
+    {
+        return this->sequence.load(std::memory_order_acquire) / 2;
+    }
+};
+}
@@ -0,0 +1,163 @@
+/**
+ * @file sharded_counter.hpp
+ * @author Jesús Blanco
+ * @brief Counters split across cache lines to scale with threads.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "cache_padded.hpp"
+#include "safety.hpp"
+#include "types.hpp"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace cy {
+namespace detail {
+/**
+ * @brief A small number identifying the caller: its CPU on Linux, or a
+ * per-thread id elsewhere (or if `sched_getcpu` fails).
+ */
+inline usize shard_hint()
+{
+#if defined(__linux__)
+    int32 cpu = ::sched_getcpu();
+    if (cpu >= 0)
+        return static_cast<usize>(cpu);
+#endif
+
+    static std::atomic<usize> next{ 0 };
+    thread_local usize        id = next.fetch_add(1, std::memory_order_relaxed);
+
+    return id;
+}
+}
+
+/**
+ * @brief A counter which many threads can increment without contending: each
+ * increment goes to a cache-padded slot picked by the caller's CPU (or thread),
+ * and reading sums every slot.
+ *
+ * Increments are relaxed. `load()` is not a snapshot: increments racing with
+ * it may or may not be included.
+ */
+class ShardedCounter
+{
+  private:
+    using Slot = CachePadded<std::atomic<uint64>>;
+
+    std::unique_ptr<Slot[]> slots;
+    usize                   mask;
+
+    static usize default_shards()
+    {
+        usize threads = std::thread::hardware_concurrency();
+        usize shards = 1;
+
+        while (shards < threads)
+            shards *= 2;
+
+        return shards;
+    }
+
+  public:
+    /**
+     * @brief Creates a counter with at least `shards` slots (rounded up to a
+     * power of two). By default, one per hardware thread.
+     */
+    explicit ShardedCounter(usize shards = default_shards())
+    {
+        usize count = 1;
+        while (count < shards)
+            count *= 2;
+
+        this->slots.reset(new Slot[count]);
+        this->mask = count - 1;
+        for (usize i = 0; i < count; i++)
+            this->slots[i]->store(0, std::memory_order_relaxed);
+    }
+
+    ShardedCounter(ShardedCounter const &) = delete;
+    ShardedCounter &operator=(ShardedCounter const &) = delete;
+
+    /**
+     * @brief Adds `n` to the counter.
+     */
+    inline void add(uint64 n = 1)
+    {
+        this->slots[detail::shard_hint() & this->mask]->fetch_add(
+            n, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Sums every slot.
+     */
+    uint64 load() const
+    {
+        uint64 sum = 0;
+        for (usize i = 0; i <= this->mask; i++)
+            sum += this->slots[i]->load(std::memory_order_relaxed);
+
+        return sum;
+    }
+
+    /**
+     * @brief Sets every slot back to zero.
+     */
+    void reset()
+    {
+        for (usize i = 0; i <= this->mask; i++)
+            this->slots[i]->store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Number of slots.
+     */
+    inline usize shards() const { return this->mask + 1; }
+};
+
+/**
+ * @brief Counts `Ok` and `Err` outcomes of `Result`s.
+ */
+class ResultCounter
+{
+  private:
+    ShardedCounter oks;
+    ShardedCounter errs;
+
+  public:
+    /**
+     * @brief Counts `result` as an `Ok` or an `Err`, handing it back.
+     * `Result` can't be moved, so the one returned is rebuilt from what
+     * `result` held.
+     */
+    template<typename T, typename E>
+    Result<T, E> record(Result<T, E> result)
+    {
+        if (result.is_err()) {
+            this->errs.add();
+            return Err<E>(result.unwrap_err());
+        }
+
+        this->oks.add();
+        if constexpr (std::is_void_v<T>)
+            return Ok();
+        else
+            return Ok<T>(result.unwrap());
+    }
+
+    inline uint64 ok_count() const { return this->oks.load(); }
+    inline uint64 err_count() const { return this->errs.load(); }
+};
+}
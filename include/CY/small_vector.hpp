@@ -0,0 +1,404 @@
+/**
+ * @file small_vector.hpp
+ * @author Jesús Blanco
+ * @brief A vector keeping its first elements inline (`SmallVector<T, N>`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "safety.hpp"
+#include "types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace cy {
+/**
+ * @brief Memory for `capacity` elements could not be allocated.
+ */
+struct AllocError
+{
+    usize capacity;
+};
+
+/**
+ * @brief A vector holding up to `N` elements inline, in the object itself,
+ * and moving them to the heap beyond that. Vectors that usually stay small
+ * never allocate.
+ *
+ * Trivially copyable elements are moved around with `memcpy` when growing or
+ * moving the vector; others are moved one by one, or copied if their move may
+ * throw, so that a throw leaves the vector as it was. Growth that could fail is
+ * surfaced by `try_push_back` and `try_reserve` as an `AllocError`, while
+ * `push_back` and `reserve` throw `std::bad_alloc` like `std::vector`.
+ *
+ * @attention Moving a vector that holds its elements inline moves each
+ * element, and pointers to them are not kept valid.
+ */
+template<typename T, usize N>
+class SmallVector
+{
+    static_assert(N > 0, "SmallVector needs room for an element inline.");
+
+  private:
+    static constexpr bool TRIVIAL = std::is_trivially_copyable_v<T>;
+
+    T    *ptr;
+    usize count;
+    usize cap;
+    alignas(T) unsigned char storage[N * sizeof(T)];
+
+    inline T *inline_data()
+    {
+        return std::launder(reinterpret_cast<T *>(this->storage));
+    }
+
+    static T *allocate(usize capacity)
+    {
+        if (capacity > max_len())
+            return nullptr;
+
+        return static_cast<T *>(::operator new(
+            capacity * sizeof(T), std::align_val_t(alignof(T)), std::nothrow));
+    }
+
+    static void deallocate(T *buffer)
+    {
+        ::operator delete(buffer, std::align_val_t(alignof(T)));
+    }
+
+    void release()
+    {
+        if (!this->is_inline())
+            deallocate(this->ptr);
+    }
+
+    /**
+     * @brief Moves `len` elements from `from` to the uninitialized `to`,
+     * leaving `from` uninitialized.
+     *
+     * Like `std::move_if_noexcept`, elements whose move may throw are copied
+     * if they can be: should a copy throw, what was built in `to` is
+     * destroyed and `from` is left as it was.
+     */
+    static void relocate(T *from, usize len, T *to)
+    {
+        if constexpr (TRIVIAL) {
+            if (len > 0)
+                std::memcpy(static_cast<void *>(to), from, len * sizeof(T));
+        } else {
+            if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                          !std::is_copy_constructible_v<T>)
+                std::uninitialized_move(from, from + len, to);
+            else
+                std::uninitialized_copy(from, from + len, to);
+
+            std::destroy(from, from + len);
+        }
+    }
+
+    /**
+     * @brief Takes the elements of `other`, which must be empty-handed
+     * (`this` holds nothing and owns no memory). If relocating them throws,
+     * `other` keeps them.
+     */
+    void take_from(SmallVector &other)
+    {
+        if (other.is_inline()) {
+            relocate(other.ptr, other.count, this->ptr);
+        } else {
+            this->ptr = std::exchange(other.ptr, other.inline_data());
+            this->cap = std::exchange(other.cap, N);
+        }
+
+        this->count = std::exchange(other.count, 0);
+    }
+
+    /**
+     * @brief Capacity to grow to for room for `needed` elements.
+     */
+    inline usize grown(usize needed) const
+    {
+        usize doubled = this->cap > max_len() / 2 ? max_len() : this->cap * 2;
+        return doubled > needed ? doubled : needed;
+    }
+
+    /**
+     * @brief Moves to a new buffer of `capacity` elements, building the
+     * element after the last one with `args` first: they may point into the
+     * old buffer. If anything throws, the vector is left as it was.
+     */
+    template<typename... Args>
+    Result<T &, AllocError> grow_emplace(usize capacity, Args &&...args)
+    {
+        T *buffer = allocate(capacity);
+        if (buffer == nullptr)
+            return Err(AllocError{ capacity });
+
+        T *element = buffer + this->count;
+        try {
+            new (element) T(std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(buffer);
+            throw;
+        }
+
+        try {
+            relocate(this->ptr, this->count, buffer);
+        } catch (...) {
+            element->~T();
+            deallocate(buffer);
+            throw;
+        }
+
+        this->release();
+        this->ptr = buffer;
+        this->cap = capacity;
+
+        return Ok<T &>(this->ptr[this->count++]);
+    }
+
+  public:
+    SmallVector()
+        : ptr(inline_data())
+        , count(0)
+        , cap(N)
+    {
+    }
+
+    SmallVector(std::initializer_list<T> values)
+        : SmallVector()
+    {
+        this->reserve(values.size());
+        std::uninitialized_copy(values.begin(), values.end(), this->ptr);
+        this->count = values.size();
+    }
+
+    SmallVector(SmallVector const &other)
+        : SmallVector()
+    {
+        this->reserve(other.count);
+        std::uninitialized_copy(other.begin(), other.end(), this->ptr);
+        this->count = other.count;
+    }
+
+    SmallVector(SmallVector &&other) noexcept(
+        std::is_nothrow_move_constructible_v<T>)
+        : SmallVector()
+    {
+        this->take_from(other);
+    }
+
+    ~SmallVector()
+    {
+        this->clear();
+        this->release();
+    }
+
+    SmallVector &operator=(SmallVector const &other)
+    {
+        if (this != &other) {
+            this->clear();
+            this->reserve(other.count);
+            std::uninitialized_copy(other.begin(), other.end(), this->ptr);
+            this->count = other.count;
+        }
+
+        return *this;
+    }
+
+    SmallVector &operator=(SmallVector &&other) noexcept(
+        std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other) {
+            this->clear();
+            this->release();
+            this->ptr = this->inline_data();
+            this->cap = N;
+            this->take_from(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Most elements a vector of `T` could hold.
+     */
+    static constexpr usize max_len()
+    {
+        return static_cast<usize>(PTRDIFF_MAX) / sizeof(T);
+    }
+
+    inline usize len() const { return this->count; }
+    inline usize size() const { return this->count; }
+    inline bool  is_empty() const { return this->count == 0; }
+    inline usize capacity() const { return this->cap; }
+
+    /**
+     * @brief Whether the elements are still kept inline.
+     */
+    inline bool is_inline() const
+    {
+        return this->ptr == reinterpret_cast<T const *>(this->storage);
+    }
+
+    inline T const *data() const { return this->ptr; }
+    inline T       *data() { return this->ptr; }
+
+    inline T const *begin() const { return this->ptr; }
+    inline T       *begin() { return this->ptr; }
+    inline T const *end() const { return this->ptr + this->count; }
+    inline T       *end() { return this->ptr + this->count; }
+
+    /**
+     * @brief Gets the element at `index`, without checking bounds.
+     */
+    inline T const &operator[](usize index) const { return this->ptr[index]; }
+    inline T       &operator[](usize index) { return this->ptr[index]; }
+
+    /**
+     * @brief Gets the element at `index`, or `None` if out of bounds.
+     */
+    inline Maybe<T &> try_at(usize index)
+    {
+        if (index >= this->count)
+            return None();
+
+        return Some<T &>(this->ptr[index]);
+    }
+
+    /**
+     * @brief Makes room for `capacity` elements in all.
+     *
+     * @return `Ok`, or the `AllocError` if the memory could not be allocated
+     * (the vector is left as it was).
+     */
+    Result<void, AllocError> try_reserve(usize capacity)
+    {
+        if (capacity <= this->cap)
+            return Ok();
+
+        T *buffer = allocate(capacity);
+        if (buffer == nullptr)
+            return Err(AllocError{ capacity });
+
+        try {
+            relocate(this->ptr, this->count, buffer);
+        } catch (...) {
+            deallocate(buffer);
+            throw;
+        }
+
+        this->release();
+        this->ptr = buffer;
+        this->cap = capacity;
+
+        return Ok();
+    }
+
+    /**
+     * @brief Makes room for `capacity` elements in all.
+     *
+     * @exception std::bad_alloc Thrown if the memory could not be allocated.
+     */
+    void reserve(usize capacity)
+    {
+        if (this->try_reserve(capacity).is_err())
+            throw std::bad_alloc();
+    }
+
+    /**
+     * @brief Builds an element at the end from `args`, growing if full.
+     *
+     * @return A reference to the element, or the `AllocError` if growing
+     * failed (the vector is left as it was).
+     */
+    template<typename... Args>
+    Result<T &, AllocError> try_emplace_back(Args &&...args)
+    {
+        if (this->count == this->cap)
+            return this->grow_emplace(this->grown(this->count + 1),
+                                      std::forward<Args>(args)...);
+
+        new (this->ptr + this->count) T(std::forward<Args>(args)...);
+        return Ok<T &>(this->ptr[this->count++]);
+    }
+
+    /**
+     * @brief Appends `value`, growing if full.
+     *
+     * @return A reference to the element, or the `AllocError` if growing
+     * failed (the vector and `value` are left as they were).
+     */
+    inline Result<T &, AllocError> try_push_back(T &&value)
+    {
+        return this->try_emplace_back(std::move(value));
+    }
+
+    inline Result<T &, AllocError> try_push_back(T const &value)
+    {
+        return this->try_emplace_back(value);
+    }
+
+    /**
+     * @brief Builds an element at the end from `args`, growing if full.
+     *
+     * @exception std::bad_alloc Thrown if growing failed.
+     */
+    template<typename... Args>
+    T &emplace_back(Args &&...args)
+    {
+        auto result = this->try_emplace_back(std::forward<Args>(args)...);
+        if (result.is_err())
+            throw std::bad_alloc();
+
+        return result.unwrap();
+    }
+
+    /**
+     * @brief Appends `value`, growing if full.
+     *
+     * @exception std::bad_alloc Thrown if growing failed.
+     */
+    inline T &push_back(T &&value)
+    {
+        return this->emplace_back(std::move(value));
+    }
+
+    inline T &push_back(T const &value) { return this->emplace_back(value); }
+
+    /**
+     * @brief Removes the last element, or returns `None` if empty.
+     */
+    Maybe<T> pop_back()
+    {
+        if (this->count == 0)
+            return None();
+
+        T       *last = this->ptr + --this->count;
+        Maybe<T> value = Some(std::move(*last));
+        last->~T();
+
+        return value;
+    }
+
+    /**
+     * @brief Destroys every element, keeping the capacity.
+     */
+    void clear()
+    {
+        std::destroy(this->ptr, this->ptr + this->count);
+        this->count = 0;
+    }
+};
+}
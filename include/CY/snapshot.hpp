@@ -0,0 +1,160 @@
+/**
+ * @file snapshot.hpp
+ * @author Jesús Blanco
+ * @brief A value swapped as a whole while threads read it, RCU style
+ * (`Snapshot<T>`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "epoch.hpp"
+#include "safety.hpp"
+#include "types.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace cy {
+/**
+ * @brief A read-only view of the version of a `Snapshot` current when it was
+ * loaded, valid for as long as the guard lives, whatever is stored meanwhile.
+ */
+template<typename T>
+class SnapshotGuard
+{
+  private:
+    EpochGuard epoch;
+    T const   *value;
+
+    SnapshotGuard(EpochGuard &&epoch, T const *value)
+        : epoch(std::move(epoch))
+        , value(value)
+    {
+    }
+
+    template<typename U>
+    friend class Snapshot;
+
+  public:
+    inline T const &get() const { return *this->value; }
+    inline T const &operator*() const { return *this->value; }
+    inline T const *operator->() const { return this->value; }
+};
+
+/**
+ * @brief A `T` read by many threads and replaced now and then (a
+ * configuration, a routing table): readers get the current version without
+ * locking, writers publish a whole new one, and old versions are freed by the
+ * global `Collector` once no reader holds them.
+ *
+ * `load()` pins the epoch (a store and a fence to a slot of the thread's own)
+ * and loads one pointer; no read-modify-write of shared memory, so readers
+ * don't contend. Writers take turns on a mutex.
+ *
+ * @code
+ * cy::Snapshot<Config> config(Config::defaults());
+ *
+ * // Request path:
+ * auto current = config.load();
+ * route(request, current->routes);
+ *
+ * // Reload:
+ * auto reloaded = config.try_update(
+ *     [](Config const &old) { return Config::parse(read_file(path), old); });
+ * @endcode
+ */
+template<typename T>
+class Snapshot
+{
+  private:
+    std::atomic<T const *> current;
+    std::mutex             writer;
+
+    /**
+     * @brief Publishes `next`, retiring the version it replaces. Must hold
+     * `writer`.
+     */
+    void publish(std::unique_ptr<T const> next)
+    {
+        T const *old =
+            this->current.exchange(next.release(), std::memory_order_acq_rel);
+
+        Collector &collector = Collector::global();
+        collector.retire(old);
+        collector.collect();
+    }
+
+  public:
+    explicit Snapshot(T value)
+        : current(new T(std::move(value)))
+    {
+    }
+
+    Snapshot(Snapshot const &) = delete;
+    Snapshot &operator=(Snapshot const &) = delete;
+
+    /**
+     * @brief Retires the current version: readers must be done with the
+     * `Snapshot` itself, but may still hold guards.
+     */
+    ~Snapshot()
+    {
+        Collector::global().retire(
+            this->current.load(std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief The current version, kept alive until the guard is dropped.
+     */
+    SnapshotGuard<T> load() const
+    {
+        EpochGuard epoch = Collector::global().pin();
+        return SnapshotGuard<T>(
+            std::move(epoch), this->current.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Publishes `value` as the new version.
+     */
+    void store(T value)
+    {
+        auto next = std::make_unique<T const>(std::move(value));
+
+        std::lock_guard<std::mutex> guard(this->writer);
+        this->publish(std::move(next));
+    }
+
+    /**
+     * @brief Builds the new version from the current one with `func`, taking
+     * `T const &` and returning `Result<T, E>`, and publishes it if it is
+     * `Ok`. On `Err`, the current version stays in place. Writers wait for
+     * each other, so no update is lost.
+     */
+    template<typename F>
+    Result<void,
+           typename detail::ResultTraits<
+               std::invoke_result_t<F &, T const &>>::Error>
+    try_update(F &&func)
+    {
+        using R = std::invoke_result_t<F &, T const &>;
+        static_assert(
+            std::is_same_v<typename detail::ResultTraits<R>::Value, T>,
+            "try_update needs a function returning Result<T, E>.");
+
+        std::lock_guard<std::mutex> guard(this->writer);
+        R result = func(*this->current.load(std::memory_order_relaxed));
+        if (result.is_err())
+            return Err(result.unwrap_err());
+
+        this->publish(std::make_unique<T const>(result.unwrap()));
+        return Ok();
+    }
+};
+}
@@ -0,0 +1,167 @@
+/**
+ * @file span.hpp
+ * @author Jesús Blanco
+ * @brief A view over contiguous values with checked access (`Span<T>`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "safety.hpp"
+#include "types.hpp"
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace cy {
+/**
+ * @brief A non-owning view over `len()` contiguous `T`s (`Span<T const>` for
+ * read-only access). `try_at` and `try_subspan` check bounds and return
+ * `None` when out of range; `operator[]` does not check.
+ */
+template<typename T>
+class Span
+{
+  private:
+    T    *ptr;
+    usize count;
+
+  public:
+    constexpr Span()
+        : ptr(nullptr)
+        , count(0)
+    {
+    }
+
+    constexpr Span(T *data, usize len)
+        : ptr(data)
+        , count(len)
+    {
+    }
+
+    template<usize N>
+    constexpr Span(T (&array)[N])
+        : ptr(array)
+        , count(N)
+    {
+    }
+
+    /**
+     * @brief Views a contiguous container (`std::vector`, `std::array`,
+     * another `Span`...).
+     */
+    template<typename C,
+             typename = std::enable_if_t<std::is_convertible_v<
+                 std::remove_pointer_t<decltype(std::data(
+                     std::declval<C &>()))> (*)[],
+                 T (*)[]>>>
+    constexpr Span(C &container)
+        : ptr(std::data(container))
+        , count(std::size(container))
+    {
+    }
+
+    inline constexpr T    *data() const { return this->ptr; }
+    inline constexpr usize len() const { return this->count; }
+    inline constexpr usize size() const { return this->count; }
+    inline constexpr bool  is_empty() const { return this->count == 0; }
+
+    inline constexpr T *begin() const { return this->ptr; }
+    inline constexpr T *end() const { return this->ptr + this->count; }
+
+    /**
+     * @brief Gets the element at `index`, without checking bounds.
+     */
+    inline constexpr T &operator[](usize index) const
+    {
+        return this->ptr[index];
+    }
+
+    /**
+     * @brief Gets the element at `index`, or `None` if out of bounds.
+     */
+    inline Maybe<T &> try_at(usize index) const
+    {
+        if (index >= this->count)
+            return None();
+
+        return Some<T &>(this->ptr[index]);
+    }
+
+    /**
+     * @brief The `len` elements starting at `offset`, or `None` if they are not
+     * all within this span.
+     */
+    inline Maybe<Span> try_subspan(usize offset, usize len) const
+    {
+        if (offset > this->count || len > this->count - offset)
+            return None();
+
+        return Some(Span(this->ptr + offset, len));
+    }
+
+    /**
+     * @brief The elements from `offset` to the end, or `None` if `offset` is
+     * past the end.
+     */
+    inline Maybe<Span> try_subspan(usize offset) const
+    {
+        if (offset > this->count)
+            return None();
+
+        return Some(Span(this->ptr + offset, this->count - offset));
+    }
+
+    /**
+     * @brief Splits into [0, mid) and [mid, len()), or `None` if `mid` is past
+     * the end.
+     */
+    inline Maybe<std::pair<Span, Span>> split_at(usize mid) const
+    {
+        if (mid > this->count)
+            return None();
+
+        return Some(std::make_pair(Span(this->ptr, mid),
+                                   Span(this->ptr + mid, this->count - mid)));
+    }
+};
+
+template<typename T, usize N>
+Span(T (&)[N]) -> Span<T>;
+
+template<typename C>
+Span(C &)
+    -> Span<std::remove_pointer_t<decltype(std::data(std::declval<C &>()))>>;
+
+/**
+ * @brief Checks once that `span` has at least `n` elements and, if so, calls
+ * `body` with a span of exactly the first `n`, so loops over [0, n) in it can
+ * index with `operator[]` and no per-element check (letting the compiler
+ * vectorize them).
+ *
+ * @return `Some` of what `body` returned (or `true`, if it returns `void`), or
+ * `None` (`false`) if `span` is too short and `body` was not called.
+ */
+template<typename T, typename F>
+auto with_checked_range(Span<T> span, usize n, F &&body)
+{
+    using R = std::invoke_result_t<F &, Span<T>>;
+
+    if constexpr (std::is_void_v<R>) {
+        if (n > span.len())
+            return false;
+
+        body(Span<T>(span.data(), n));
+        return true;
+    } else {
+        if (n > span.len())
+            return Maybe<R>(None());
+
+        return Maybe<R>(Some<R>(body(Span<T>(span.data(), n))));
+    }
+}
+}
@@ -0,0 +1,146 @@
+/**
+ * @file spsc_queue.hpp
+ * @author Jesús Blanco
+ * @brief A bounded lock-free single-producer single-consumer queue
+ * (`SpscQueue<T>`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "cache_padded.hpp"
+#include "safety.hpp"
+#include "types.hpp"
+#include <atomic>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace cy {
+/**
+ * @brief A ring buffer of at most `capacity()` items, between exactly one
+ * producer thread (`try_push`) and one consumer thread (`try_pop`).
+ *
+ * Each side owns one index and only reads the other's when its cached copy
+ * says the ring is full (or empty), so in the steady state a push or pop
+ * touches no cache line the other thread writes.
+ */
+template<typename T>
+class SpscQueue
+{
+  private:
+    struct Slot
+    {
+        alignas(T) unsigned char bytes[sizeof(T)];
+
+        inline T *get() { return std::launder(reinterpret_cast<T *>(bytes)); }
+    };
+
+    usize                   mask;
+    std::unique_ptr<Slot[]> slots;
+
+    // Next slot to pop, written by the consumer, and the producer's copy.
+    CachePadded<std::atomic<usize>> head;
+    CachePadded<usize>              cached_head;
+    // Next slot to push, written by the producer, and the consumer's copy.
+    CachePadded<std::atomic<usize>> tail;
+    CachePadded<usize>              cached_tail;
+
+    template<typename U>
+    bool push(U &&value)
+    {
+        usize t = this->tail->load(std::memory_order_relaxed);
+        if (t - *this->cached_head > this->mask) {
+            *this->cached_head = this->head->load(std::memory_order_acquire);
+            if (t - *this->cached_head > this->mask)
+                return false;
+        }
+
+        new (this->slots[t & this->mask].bytes) T(std::forward<U>(value));
+        this->tail->store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+  public:
+    /**
+     * @brief Creates an empty queue with room for `capacity` items (rounded up
+     * to a power of two).
+     *
+     * @exception std::invalid_argument Thrown if `capacity` is 0.
+     */
+    explicit SpscQueue(usize capacity)
+        : head(0)
+        , cached_head(0)
+        , tail(0)
+        , cached_tail(0)
+    {
+        if (capacity == 0)
+            throw std::invalid_argument("SpscQueue needs room for an item");
+
+        usize rounded = 1;
+        while (rounded < capacity)
+            rounded *= 2;
+
+        this->mask = rounded - 1;
+        this->slots.reset(new Slot[rounded]);
+    }
+
+    SpscQueue(SpscQueue const &) = delete;
+    SpscQueue &operator=(SpscQueue const &) = delete;
+
+    ~SpscQueue()
+    {
+        usize t = this->tail->load(std::memory_order_relaxed);
+        for (usize h = this->head->load(std::memory_order_relaxed); h != t;
+             h++)
+            this->slots[h & this->mask].get()->~T();
+    }
+
+    /**
+     * @brief Appends `value`, or returns false (leaving `value` untouched) if
+     * the queue is full. Only call it from the producer.
+     */
+    inline bool try_push(T &&value) { return this->push(std::move(value)); }
+    inline bool try_push(T const &value) { return this->push(value); }
+
+    /**
+     * @brief Removes the oldest item, or returns `None` if the queue is empty.
+     * Only call it from the consumer.
+     */
+    Maybe<T> try_pop()
+    {
+        usize h = this->head->load(std::memory_order_relaxed);
+        if (h == *this->cached_tail) {
+            *this->cached_tail = this->tail->load(std::memory_order_acquire);
+            if (h == *this->cached_tail)
+                return None();
+        }
+
+        T       *item = this->slots[h & this->mask].get();
+        Maybe<T> value = Some(std::move(*item));
+        item->~T();
+
+        this->head->store(h + 1, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * @brief Number of items, exact only while neither side is working on it.
+     */
+    inline usize len() const
+    {
+        usize h = this->head->load(std::memory_order_acquire);
+        usize t = this->tail->load(std::memory_order_acquire);
+        return t > h ? t - h : 0;
+    }
+
+    inline bool  is_empty() const { return this->len() == 0; }
+    inline bool  is_full() const { return this->len() > this->mask; }
+    inline usize capacity() const { return this->mask + 1; }
+};
+}
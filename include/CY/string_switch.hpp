@@ -0,0 +1,231 @@
+/**
+ * @file string_switch.hpp
+ * @author Jesús Blanco
+ * @brief Compile-time perfect hash tables over string literals
+ * (`string_switch`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "hash.hpp"
+#include "safety.hpp"
+#include "types.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+namespace cy {
+/**
+ * @brief A perfect hash table from `N` distinct keys to their positions in
+ * [0, N), built by `string_switch`.
+ *
+ * Keys are hashed into buckets, and each bucket gets a displacement that
+ * sends its keys to free slots (hash and displace), so `match` hashes its
+ * argument once, reads one bucket and one slot, and compares one key.
+ */
+template<usize N>
+class StringSwitch
+{
+    static_assert(N > 0, "string_switch needs at least one key.");
+
+  private:
+    static constexpr usize slot_count()
+    {
+        usize slots = 1;
+        while (slots < N)
+            slots *= 2;
+
+        return slots;
+    }
+
+    static constexpr usize SLOTS = slot_count();
+    static constexpr usize MAX_DISPLACEMENT = usize(1) << 20;
+
+    struct Slot
+    {
+        strview key;
+        usize   index;
+    };
+
+    std::array<strview, N>    keys;
+    std::array<uint32, SLOTS> displacements;
+    std::array<Slot, SLOTS>   slots;
+
+    /**
+     * @brief FNV-1a barely changes the high bits for short keys, which pick
+     * the bucket, so its result is mixed once more.
+     */
+    static constexpr uint64 hash_of(strview key) { return mix64(fnv1a(key)); }
+
+    static constexpr usize bucket_of(uint64 hash)
+    {
+        return static_cast<usize>(hash >> 32) & (SLOTS - 1);
+    }
+
+    static constexpr usize slot_of(uint64 hash, uint32 displacement)
+    {
+        return static_cast<usize>(mix64(hash ^ displacement)) & (SLOTS - 1);
+    }
+
+    /**
+     * @brief Finds a displacement for every bucket, fullest buckets first,
+     * while they still have the most free slots to choose from.
+     */
+    constexpr void build()
+    {
+        std::array<uint64, N>        hashes{};
+        std::array<usize, SLOTS + 1> starts{};
+        std::array<usize, N>         order{};
+        std::array<bool, SLOTS>      taken{};
+
+        for (usize i = 0; i < N; i++) {
+            for (usize j = 0; j < i; j++) {
+                if (this->keys[i] == this->keys[j])
+                    throw std::invalid_argument(
+                        "Duplicate key in string_switch.");
+            }
+
+            hashes[i] = hash_of(this->keys[i]);
+            starts[bucket_of(hashes[i]) + 1]++;
+        }
+
+        // Group the keys by bucket: bucket b holds order[starts[b]] up to
+        // order[starts[b + 1]].
+        usize largest = 0;
+        for (usize bucket = 0; bucket < SLOTS; bucket++) {
+            largest = std::max(largest, starts[bucket + 1]);
+            starts[bucket + 1] += starts[bucket];
+        }
+
+        std::array<usize, SLOTS> cursors{};
+        for (usize i = 0; i < N; i++) {
+            usize bucket = bucket_of(hashes[i]);
+            order[starts[bucket] + cursors[bucket]++] = i;
+        }
+
+        for (usize size = largest; size > 0; size--) {
+            for (usize bucket = 0; bucket < SLOTS; bucket++) {
+                usize first = starts[bucket];
+                if (starts[bucket + 1] - first != size)
+                    continue;
+
+                for (uint32 d = 0;; d++) {
+                    if (d == MAX_DISPLACEMENT)
+                        throw std::logic_error(
+                            "string_switch could not build a perfect hash.");
+
+                    usize placed = 0;
+                    while (placed < size) {
+                        usize slot = slot_of(hashes[order[first + placed]], d);
+                        if (taken[slot])
+                            break;
+
+                        taken[slot] = true;
+                        placed++;
+                    }
+
+                    if (placed == size) {
+                        this->displacements[bucket] = d;
+                        break;
+                    }
+
+                    for (usize j = 0; j < placed; j++)
+                        taken[slot_of(hashes[order[first + j]], d)] = false;
+                }
+            }
+        }
+
+        for (usize i = 0; i < N; i++) {
+            uint32 d = this->displacements[bucket_of(hashes[i])];
+            this->slots[slot_of(hashes[i], d)] = Slot{ this->keys[i], i };
+        }
+    }
+
+  public:
+    constexpr explicit StringSwitch(std::array<strview, N> keys)
+        : keys(keys)
+        , displacements{}
+        , slots{}
+    {
+        for (auto &slot : this->slots)
+            slot.index = N;
+
+        this->build();
+    }
+
+    inline constexpr usize len() const { return N; }
+
+    /**
+     * @brief The key at `index`, in the order they were given.
+     */
+    inline constexpr strview key(usize index) const
+    {
+        return this->keys[index];
+    }
+
+    /**
+     * @brief The position of `key`, which must be one of the keys. Meant for
+     * `case` labels; throws std::out_of_range (a compile error, in a constant
+     * expression) otherwise.
+     */
+    constexpr usize index(strview key) const
+    {
+        for (usize i = 0; i < N; i++) {
+            if (this->keys[i] == key)
+                return i;
+        }
+
+        throw std::out_of_range("Not a key of this string_switch.");
+    }
+
+    /**
+     * @brief The position of `key` among the keys, or `None` if it is not one
+     * of them.
+     */
+    inline Maybe<usize> match(strview key) const
+    {
+        uint64      hash = hash_of(key);
+        uint32      d = this->displacements[bucket_of(hash)];
+        Slot const &slot = this->slots[slot_of(hash, d)];
+
+        if (slot.index == N || slot.key.size() != key.size())
+            return None();
+
+        // An empty view may hold a null pointer, which memcmp can't take.
+        if (key.size() != 0 &&
+            std::memcmp(slot.key.data(), key.data(), key.size()) != 0)
+            return None();
+
+        return Some(slot.index);
+    }
+};
+
+/**
+ * @brief Builds a `StringSwitch` over `keys`, which must be distinct. Declare
+ * it `constexpr` to build the table at compile time:
+ *
+ * @code
+ * constexpr auto COMMANDS = cy::string_switch("start", "stop", "status");
+ *
+ * auto command = COMMANDS.match(name);
+ * if (command.is_none())
+ *     return;
+ *
+ * switch (command.unwrap()) {
+ *     case COMMANDS.index("start"): ...
+ *     case COMMANDS.index("stop"): ...
+ * }
+ * @endcode
+ */
+template<typename... Keys>
+constexpr StringSwitch<sizeof...(Keys)> string_switch(Keys const &...keys)
+{
+    return StringSwitch<sizeof...(Keys)>({ strview(keys)... });
+}
+}
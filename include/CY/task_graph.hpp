@@ -0,0 +1,443 @@
+/**
+ * @file task_graph.hpp
+ * @author Jesús Blanco
+ * @brief Dependency graphs of fallible tasks run on a `ThreadPool`
+ * (`TaskGraph`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "safety.hpp"
+#include "thread_pool.hpp"
+#include "types.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cy {
+/**
+ * @brief Handle to a task of a `TaskGraph` whose function returns a
+ * `Result<T, E>`. Pass it to `TaskGraph::add` to feed its value to another
+ * task.
+ */
+template<typename T>
+class Task
+{
+  private:
+    usize index;
+
+    explicit Task(usize index)
+        : index(index)
+    {
+    }
+
+    template<typename E>
+    friend class TaskGraph;
+
+  public:
+    /**
+     * @brief Position of the task in its graph, in the order they were added.
+     */
+    inline usize id() const { return this->index; }
+};
+
+/**
+ * @brief A task that returned an `Err`.
+ */
+template<typename E>
+struct TaskError
+{
+    /// @brief `id()` of the task.
+    usize task;
+    E     error;
+};
+
+namespace detail {
+template<typename E>
+void run_task(Job *job);
+
+/**
+ * @brief What the graph knows of a task, whatever its type.
+ */
+template<typename E>
+class TaskNodeBase : public Job
+{
+  public:
+    TaskGraph<E>               *graph = nullptr;
+    usize                       index = 0;
+    std::vector<TaskNodeBase *> dependents;
+    usize                       inputs = 0;
+    usize                       consumers = 0;
+
+    // Reset by every run.
+    std::atomic<usize> pending{ 0 };
+    std::atomic<usize> consumers_left{ 0 };
+    std::atomic<bool>  poisoned{ false };
+
+    TaskNodeBase()
+        : Job{ &run_task<E> }
+    {
+    }
+
+    virtual ~TaskNodeBase() = default;
+
+    /**
+     * @brief Calls the function on the values of the inputs, keeping its
+     * value. Returns its error, if any.
+     */
+    virtual Maybe<E> call() = 0;
+};
+
+/**
+ * @brief A task with an output of type `T`.
+ */
+template<typename E, typename T>
+class TaskValue : public TaskNodeBase<E>
+{
+  public:
+    using Stored = std::conditional_t<std::is_void_v<T>, Unit, T>;
+
+    Maybe<Stored> output;
+
+    /**
+     * @brief The value, for one of its consumers: moved to the last one that
+     * takes it, and copied for the others.
+     */
+    Stored take()
+    {
+        // Everyone else already took their copy if only this consumer is left.
+        if (this->consumers_left.load(std::memory_order_acquire) == 1)
+            return this->output.unwrap();
+
+        if constexpr (std::is_copy_constructible_v<Stored>) {
+            Stored copy = this->output.get();
+            this->consumers_left.fetch_sub(1, std::memory_order_acq_rel);
+            return copy;
+        } else {
+            throw std::logic_error("Copied a move-only task value");
+        }
+    }
+};
+
+/**
+ * @brief The arguments a value of type `T` passes on: none for `void`.
+ */
+template<typename T>
+using TaskArgs = std::conditional_t<std::is_void_v<T>, std::tuple<>,
+                                    std::tuple<T>>;
+
+/**
+ * @brief What `func` returns when called with the values of `In...`.
+ */
+template<typename F, typename... In>
+using TaskResult =
+    decltype(std::apply(std::declval<F &>(),
+                        std::declval<decltype(std::tuple_cat(
+                            std::declval<TaskArgs<In>>()...))>()));
+
+template<typename E, typename T, typename F, typename... In>
+class TaskNode : public TaskValue<E, T>
+{
+  private:
+    F                                 func;
+    std::tuple<TaskValue<E, In> *...> sources;
+
+    template<typename U>
+    static TaskArgs<U> argument(TaskValue<E, U> *source)
+    {
+        if constexpr (std::is_void_v<U>)
+            return std::tuple<>();
+        else
+            return TaskArgs<U>(source->take());
+    }
+
+  public:
+    TaskNode(F func, TaskValue<E, In> *...sources)
+        : func(std::move(func))
+        , sources(sources...)
+    {
+    }
+
+    Maybe<E> call() override
+    {
+        auto args = std::apply(
+            [](auto *...source) { return std::tuple_cat(argument(source)...); },
+            this->sources);
+        Result<T, E> result = std::apply(this->func, std::move(args));
+
+        if (result.is_err())
+            return Some(result.unwrap_err());
+
+        // Built in place: the value need not be assignable.
+        if constexpr (std::is_void_v<T>)
+            this->output.get_or_insert_with([] { return Unit{}; });
+        else
+            this->output.get_or_insert_with([&] { return result.unwrap(); });
+
+        return None();
+    }
+};
+}
+
+/**
+ * @brief A graph of tasks, each a function returning `Result<T, E>` that takes
+ * the values of the tasks it depends on.
+ *
+ * `run` runs each task once its inputs are done, independent ones in parallel
+ * on a `ThreadPool`. When a task fails, the tasks downstream of it are skipped
+ * and not run; the errors of every failed task are gathered. A value goes to
+ * each consumer by copy, except to the last one to take it (the only one, on
+ * single-consumer edges), which gets it moved.
+ *
+ * @code
+ * cy::TaskGraph<std::string> graph;
+ * auto text = graph.add([]() { return read_file("in.txt"); });
+ * auto words = graph.add([](std::string text) { return split(text); }, text);
+ * auto total = graph.add(
+ *     [](std::vector<std::string> words) { return count(words); }, words);
+ *
+ * if (graph.run().is_ok())
+ *     usize n = graph.take(total).unwrap();
+ * @endcode
+ */
+template<typename E>
+class TaskGraph
+{
+  private:
+    std::vector<std::unique_ptr<detail::TaskNodeBase<E>>> nodes;
+
+    // State of the current run.
+    ThreadPool               *pool = nullptr;
+    detail::Latch            *done = nullptr;
+    std::atomic<usize>        remaining{ 0 };
+    std::atomic<usize>        skipped_count{ 0 };
+    std::mutex                lock;
+    std::vector<TaskError<E>> failures;
+    std::exception_ptr        panic;
+    bool                      ran = false;
+
+    friend void detail::run_task<E>(detail::Job *job);
+
+    void finish(detail::TaskNodeBase<E> *node, bool ok)
+    {
+        for (auto *next : node->dependents) {
+            if (!ok)
+                next->poisoned.store(true, std::memory_order_relaxed);
+
+            if (next->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                this->pool->push(next);
+        }
+
+        // The graph may be gone as soon as this lets `run` return.
+        if (this->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            this->done->set();
+    }
+
+    void execute(detail::TaskNodeBase<E> *node)
+    {
+        if (node->poisoned.load(std::memory_order_relaxed)) {
+            this->skipped_count.fetch_add(1, std::memory_order_relaxed);
+            this->finish(node, false);
+            return;
+        }
+
+        bool ok = false;
+        try {
+            Maybe<E> error = node->call();
+            if (error.is_none()) {
+                ok = true;
+            } else {
+                std::lock_guard<std::mutex> guard(this->lock);
+                this->failures.push_back(
+                    TaskError<E>{ node->index, error.unwrap() });
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> guard(this->lock);
+            if (!this->panic)
+                this->panic = std::current_exception();
+        }
+
+        this->finish(node, ok);
+    }
+
+  public:
+    TaskGraph() = default;
+    TaskGraph(TaskGraph const &) = delete;
+    TaskGraph &operator=(TaskGraph const &) = delete;
+
+    /**
+     * @brief Adds a task calling `func` with the values of `inputs` (tasks
+     * returning `void` pass nothing, and only order the tasks).
+     *
+     * @exception std::invalid_argument Thrown if a move-only value would get
+     * more than one consumer.
+     */
+    template<typename F, typename... In>
+    Task<typename detail::ResultTraits<detail::TaskResult<F, In...>>::Value>
+    add(F &&func, Task<In>... inputs)
+    {
+        using R = detail::TaskResult<F, In...>;
+        using T = typename detail::ResultTraits<R>::Value;
+        static_assert(
+            std::is_same_v<typename detail::ResultTraits<R>::Error, E>,
+            "Tasks must return a Result with the graph's error type.");
+
+        std::array<detail::TaskNodeBase<E> *, sizeof...(In)> sources{
+            this->nodes.at(inputs.index).get()...
+        };
+
+        std::array<bool, sizeof...(In)> move_only{
+            !std::is_copy_constructible_v<
+                typename detail::TaskValue<E, In>::Stored>...
+        };
+
+        // Also counts an input given twice to this same task.
+        for (usize i = 0; i < sources.size(); i++) {
+            if (!move_only[i])
+                continue;
+
+            bool taken = sources[i]->consumers > 0;
+            for (usize j = 0; j < i; j++)
+                taken = taken || sources[j] == sources[i];
+
+            if (taken)
+                throw std::invalid_argument(
+                    "A move-only task value can only have one consumer");
+        }
+
+        auto node = std::make_unique<
+            detail::TaskNode<E, T, std::decay_t<F>, In...>>(
+            std::forward<F>(func),
+            static_cast<detail::TaskValue<E, In> *>(
+                this->nodes[inputs.index].get())...);
+
+        node->graph = this;
+        node->index = this->nodes.size();
+        node->inputs = sizeof...(In);
+        for (auto *source : sources) {
+            source->dependents.push_back(node.get());
+            source->consumers++;
+        }
+
+        this->nodes.push_back(std::move(node));
+        return Task<T>(this->nodes.size() - 1);
+    }
+
+    /**
+     * @brief Number of tasks.
+     */
+    inline usize len() const { return this->nodes.size(); }
+
+    /**
+     * @brief Runs every task on the pool the caller works for, or
+     * `ThreadPool::global()`.
+     *
+     * @see TaskGraph::run(ThreadPool &)
+     */
+    Result<void, std::vector<TaskError<E>>> run()
+    {
+        ThreadPool *current = ThreadPool::current();
+        return this->run(current != nullptr ? *current : ThreadPool::global());
+    }
+
+    /**
+     * @brief Runs every task on `pool` and waits for them (from a worker of
+     * `pool`, running other jobs meanwhile).
+     *
+     * @return `Ok`, or the errors of every task that failed, by `id()`.
+     * @exception std::runtime_error Thrown if the graph already ran.
+     * @exception ... Whatever a task threw (the first one to), rethrown once
+     * every other task is done. Tasks downstream of it are skipped.
+     */
+    Result<void, std::vector<TaskError<E>>> run(ThreadPool &pool)
+    {
+        if (this->ran)
+            throw std::runtime_error("Called .run() on a TaskGraph that ran");
+
+        this->ran = true;
+        if (this->nodes.empty())
+            return Ok();
+
+        for (auto &node : this->nodes) {
+            node->pending.store(node->inputs, std::memory_order_relaxed);
+            node->consumers_left.store(node->consumers,
+                                       std::memory_order_relaxed);
+        }
+
+        detail::Latch done(ThreadPool::current() != &pool);
+        this->pool = &pool;
+        this->done = &done;
+        this->remaining.store(this->nodes.size());
+
+        for (auto &node : this->nodes) {
+            if (node->inputs == 0)
+                pool.push(node.get());
+        }
+
+        pool.wait(done);
+        this->pool = nullptr;
+        this->done = nullptr;
+
+        if (this->panic)
+            std::rethrow_exception(this->panic);
+
+        if (this->failures.empty())
+            return Ok();
+
+        std::sort(this->failures.begin(),
+                  this->failures.end(),
+                  [](TaskError<E> const &a, TaskError<E> const &b) {
+                      return a.task < b.task;
+                  });
+        return Err(std::move(this->failures));
+    }
+
+    /**
+     * @brief Number of tasks the last run skipped, because a task they depend
+     * on failed.
+     */
+    inline usize skipped() const
+    {
+        return this->skipped_count.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Moves out the value of `task`, if it succeeded and its value was
+     * not moved to a consumer.
+     */
+    template<typename T>
+    Maybe<T> take(Task<T> task)
+    {
+        static_assert(!std::is_void_v<T>, "void tasks have no value.");
+
+        auto *node = static_cast<detail::TaskValue<E, T> *>(
+            this->nodes.at(task.index).get());
+        if (node->output.is_none())
+            return None();
+
+        return Some(node->output.unwrap());
+    }
+};
+
+namespace detail {
+template<typename E>
+void run_task(Job *job)
+{
+    auto *node = static_cast<TaskNodeBase<E> *>(job);
+    node->graph->execute(node);
+}
+}
+}
@@ -0,0 +1,712 @@
+/**
+ * @file thread_pool.hpp
+ * @author Jesús Blanco
+ * @brief A work-stealing thread pool with fork-join (`ThreadPool`).
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "chase_lev_deque.hpp"
+#include "safety.hpp"
+#include "types.hpp"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace cy {
+/**
+ * @brief What a task threw, caught so that it can be handed over as an `Err`.
+ */
+class Panic
+{
+  private:
+    std::exception_ptr exception;
+    std::string        text;
+
+    static std::string describe(std::exception_ptr const &exception)
+    {
+        try {
+            std::rethrow_exception(exception);
+        } catch (std::exception const &error) {
+            return error.what();
+        } catch (...) {
+            return "unknown exception";
+        }
+    }
+
+  public:
+    explicit Panic(std::exception_ptr exception)
+        : exception(exception)
+        , text(describe(exception))
+    {
+    }
+
+    /**
+     * @brief The `what()` of the exception, if it was a `std::exception`.
+     */
+    inline std::string const &message() const { return this->text; }
+
+    /**
+     * @brief The exception itself.
+     */
+    inline std::exception_ptr const &payload() const { return this->exception; }
+
+    /**
+     * @brief Throws the exception again.
+     */
+    [[noreturn]] void resume() const
+    {
+        std::rethrow_exception(this->exception);
+    }
+};
+
+namespace detail {
+/**
+ * @brief Stands in for the result of functions returning `void`.
+ */
+struct Unit
+{
+};
+
+/**
+ * @brief A unit of work the pool can run. Jobs usually live on the stack of
+ * the thread waiting for them, so they are type-erased with a plain function
+ * pointer and never allocated.
+ */
+struct Job
+{
+    void (*execute)(Job *);
+};
+
+/**
+ * @brief Set once a job finished. Threads of the pool poll it while running
+ * other jobs; threads outside of it block until it is set.
+ */
+class Latch
+{
+  private:
+    std::atomic<bool>       done{ false };
+    bool                    blocking;
+    std::mutex              lock;
+    std::condition_variable wake;
+
+  public:
+    explicit Latch(bool blocking)
+        : blocking(blocking)
+    {
+    }
+
+    inline bool probe() const
+    {
+        return this->done.load(std::memory_order_acquire);
+    }
+
+    void set()
+    {
+        if (!this->blocking) {
+            // The waiter may free the latch as soon as it sees this.
+            this->done.store(true, std::memory_order_release);
+            return;
+        }
+
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->done.store(true, std::memory_order_release);
+        this->wake.notify_all();
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> guard(this->lock);
+        this->wake.wait(guard, [this]() { return this->probe(); });
+    }
+};
+
+/**
+ * @brief A job running `F`, keeping its result (or exception) until the owner
+ * takes it.
+ */
+template<typename F>
+class StackJob : public Job
+{
+  public:
+    using Output = std::invoke_result_t<F &>;
+
+  private:
+    using Stored = std::conditional_t<std::is_void_v<Output>, Unit, Output>;
+
+    F                  func;
+    Maybe<Stored>      output;
+    std::exception_ptr error;
+
+    static void run(Job *job)
+    {
+        auto *self = static_cast<StackJob *>(job);
+
+        try {
+            if constexpr (std::is_void_v<Output>) {
+                self->func();
+                self->output.insert(Unit{});
+            } else {
+                self->output.insert(self->func());
+            }
+        } catch (...) {
+            self->error = std::current_exception();
+        }
+
+        self->latch.set();
+    }
+
+  public:
+    Latch latch;
+
+    StackJob(F func, bool blocking)
+        : Job{ &StackJob::run }
+        , func(std::forward<F>(func))
+        , latch(blocking)
+    {
+    }
+
+    /**
+     * @brief Gets the result once `latch` is set, rethrowing what `F` threw.
+     */
+    Output take()
+    {
+        if (this->error)
+            std::rethrow_exception(this->error);
+
+        if constexpr (!std::is_void_v<Output>)
+            return this->output.unwrap();
+    }
+};
+
+/**
+ * @brief What a spawned task and its `JoinHandle` share.
+ */
+template<typename T>
+struct SpawnState
+{
+    using Stored = std::conditional_t<std::is_void_v<T>, Unit, T>;
+
+    Latch         latch{ true };
+    Maybe<Stored> output;
+    Maybe<Panic>  panic;
+};
+
+/**
+ * @brief A spawned job, which owns its function and frees itself once run.
+ */
+template<typename F, typename T>
+class HeapJob : public Job
+{
+  private:
+    F                              func;
+    std::shared_ptr<SpawnState<T>> state;
+
+    static void run(Job *job)
+    {
+        std::unique_ptr<HeapJob> self(static_cast<HeapJob *>(job));
+        SpawnState<T>           &state = *self->state;
+
+        try {
+            if constexpr (std::is_void_v<T>) {
+                self->func();
+                state.output.insert(Unit{});
+            } else {
+                state.output.insert(self->func());
+            }
+        } catch (...) {
+            state.panic.insert(Panic(std::current_exception()));
+        }
+
+        state.latch.set();
+    }
+
+  public:
+    HeapJob(F func, std::shared_ptr<SpawnState<T>> state)
+        : Job{ &HeapJob::run }
+        , func(std::move(func))
+        , state(std::move(state))
+    {
+    }
+};
+
+/**
+ * @brief A word idle workers sleep on: waiting blocks only while it still holds
+ * the value seen before, and every notification changes it. A futex on Linux,
+ * a condition variable elsewhere.
+ */
+class IdleWord
+{
+  private:
+    std::atomic<uint32> word{ 0 };
+#if !defined(__linux__)
+    std::mutex              lock;
+    std::condition_variable wake;
+#endif
+
+  public:
+    inline uint32 load() const { return this->word.load(); }
+
+    void wait(uint32 seen)
+    {
+#if defined(__linux__)
+        static_assert(sizeof(std::atomic<uint32>) == sizeof(uint32));
+        ::syscall(SYS_futex,
+                  reinterpret_cast<uint32 *>(&this->word),
+                  FUTEX_WAIT_PRIVATE,
+                  seen,
+                  nullptr,
+                  nullptr,
+                  0);
+#else
+        std::unique_lock<std::mutex> guard(this->lock);
+        this->wake.wait(guard,
+                        [this, seen]() { return this->word.load() != seen; });
+#endif
+    }
+
+    void notify(bool all)
+    {
+        this->word.fetch_add(1);
+#if defined(__linux__)
+        ::syscall(SYS_futex,
+                  reinterpret_cast<uint32 *>(&this->word),
+                  FUTEX_WAKE_PRIVATE,
+                  all ? INT_MAX : 1,
+                  nullptr,
+                  nullptr,
+                  0);
+#else
+        {
+            std::lock_guard<std::mutex> guard(this->lock);
+        }
+        if (all)
+            this->wake.notify_all();
+        else
+            this->wake.notify_one();
+#endif
+    }
+};
+
+/**
+ * @brief Pins the calling thread to `cpu`. Only does something on Linux.
+ */
+inline bool pin_to_cpu(usize cpu)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+}
+
+template<typename T>
+class JoinHandle;
+template<typename E>
+class TaskGraph;
+
+/**
+ * @brief How to start a `ThreadPool`.
+ */
+struct PoolOptions
+{
+    /// @brief Number of workers, or 0 for one per hardware thread.
+    usize threads = 0;
+    /// @brief Whether to pin worker `i` to CPU `i` (Linux only).
+    bool pin_threads = false;
+};
+
+/**
+ * @brief A fixed set of worker threads, each with its own `ChaseLevDeque` of
+ * jobs. Workers run their newest job first and, when out of work, steal the
+ * oldest job of a random other worker, so big pieces of recursively split work
+ * spread out while each worker keeps to the data it has in cache. Workers
+ * which find nothing to do spin briefly, then park on a futex until new jobs
+ * are pushed.
+ *
+ * `join(a, b)` is the building block: it offers `b` to other workers, runs `a`,
+ * then runs `b` itself unless it was stolen meanwhile. `install(f)` runs `f`
+ * on a worker, from any thread. `spawn(f)` runs `f` in the background, handing
+ * back a `JoinHandle`.
+ */
+class ThreadPool
+{
+  private:
+    /// @brief Failed searches for a job before a worker parks.
+    static constexpr usize SPIN_ROUNDS = 64;
+
+    struct Current
+    {
+        ThreadPool *pool = nullptr;
+        usize       index = 0;
+        uint64      seed = 0;
+    };
+
+    std::unique_ptr<ChaseLevDeque<detail::Job *>[]> deques;
+    usize                                           count;
+
+    std::mutex                injector_lock;
+    std::deque<detail::Job *> injected;
+    /// @brief Size of `injected`, read without the lock.
+    std::atomic<usize> injected_count{ 0 };
+
+    std::atomic<usize> queued{ 0 };
+    std::atomic<usize> sleepers{ 0 };
+    std::atomic<bool>  stopping{ false };
+    detail::IdleWord   idle;
+
+    std::vector<std::thread> threads;
+
+    template<typename T>
+    friend class JoinHandle;
+    template<typename E>
+    friend class TaskGraph;
+
+    static Current &current_worker()
+    {
+        thread_local Current current;
+        return current;
+    }
+
+    static usize default_threads()
+    {
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    void push(detail::Job *job)
+    {
+        Current &current = current_worker();
+
+        if (current.pool == this) {
+            this->deques[current.index].push(job);
+        } else {
+            std::lock_guard<std::mutex> guard(this->injector_lock);
+            this->injected.push_back(job);
+            this->injected_count.fetch_add(1);
+        }
+
+        this->queued.fetch_add(1);
+        if (this->sleepers.load() > 0)
+            this->idle.notify(false);
+    }
+
+    detail::Job *find_job(Current &current)
+    {
+        Maybe<detail::Job *> job = this->deques[current.index].pop();
+
+        if (job.is_none() && this->count > 1) {
+            // xorshift64
+            current.seed ^= current.seed << 13;
+            current.seed ^= current.seed >> 7;
+            current.seed ^= current.seed << 17;
+
+            usize start = static_cast<usize>(current.seed % this->count);
+            for (usize i = 0; i < this->count && job.is_none(); i++) {
+                usize victim = (start + i) % this->count;
+                if (victim != current.index)
+                    job = this->deques[victim].steal();
+            }
+        }
+
+        // Only jobs pushed from outside the pool land here, so most searches
+        // see a zero count and never touch the lock.
+        if (job.is_none() && this->injected_count.load() > 0) {
+            std::lock_guard<std::mutex> guard(this->injector_lock);
+            if (!this->injected.empty()) {
+                job.insert(this->injected.front());
+                this->injected.pop_front();
+                this->injected_count.fetch_sub(1);
+            }
+        }
+
+        if (job.is_none())
+            return nullptr;
+
+        this->queued.fetch_sub(1);
+        return job.unwrap();
+    }
+
+    void run_worker(usize index, bool pin)
+    {
+        Current &current = current_worker();
+        current.pool = this;
+        current.index = index;
+        current.seed = (index + 1) * 0x9E3779B97F4A7C15ull;
+
+        if (pin)
+            detail::pin_to_cpu(index % default_threads());
+
+        usize rounds = 0;
+        while (true) {
+            detail::Job *job = this->find_job(current);
+            if (job != nullptr) {
+                job->execute(job);
+                rounds = 0;
+                continue;
+            }
+
+            if (this->stopping.load() && this->queued.load() == 0)
+                return;
+
+            if (++rounds < SPIN_ROUNDS) {
+                std::this_thread::yield();
+                continue;
+            }
+            rounds = 0;
+
+            uint32 seen = this->idle.load();
+            this->sleepers.fetch_add(1);
+            if (!this->stopping.load() && this->queued.load() == 0)
+                this->idle.wait(seen);
+            this->sleepers.fetch_sub(1);
+        }
+    }
+
+    /**
+     * @brief Waits until `latch` is set, running other jobs meanwhile if called
+     * from a worker of this pool.
+     */
+    void wait(detail::Latch &latch)
+    {
+        Current &current = current_worker();
+        if (current.pool != this) {
+            latch.wait();
+            return;
+        }
+
+        while (!latch.probe()) {
+            detail::Job *job = this->find_job(current);
+            if (job != nullptr)
+                job->execute(job);
+            else
+                std::this_thread::yield();
+        }
+    }
+
+  public:
+    /**
+     * @brief Starts `threads` workers (at least one). By default, one per
+     * hardware thread.
+     */
+    explicit ThreadPool(usize threads = default_threads())
+        : ThreadPool(PoolOptions{ threads, false })
+    {
+    }
+
+    explicit ThreadPool(PoolOptions options)
+        : count(options.threads > 0 ? options.threads : default_threads())
+    {
+        this->deques.reset(new ChaseLevDeque<detail::Job *>[this->count]);
+
+        this->threads.reserve(this->count);
+        for (usize i = 0; i < this->count; i++) {
+            this->threads.emplace_back([this, i, options]() {
+                this->run_worker(i, options.pin_threads);
+            });
+        }
+    }
+
+    ThreadPool(ThreadPool const &) = delete;
+    ThreadPool &operator=(ThreadPool const &) = delete;
+
+    /**
+     * @brief Runs every queued job, then stops the workers.
+     */
+    ~ThreadPool()
+    {
+        this->stopping.store(true);
+        this->idle.notify(true);
+
+        for (auto &thread : this->threads)
+            thread.join();
+    }
+
+    /**
+     * @brief Number of workers.
+     */
+    inline usize size() const { return this->count; }
+
+    /**
+     * @brief The pool the calling thread works for, if any.
+     */
+    static ThreadPool *current() { return current_worker().pool; }
+
+    /**
+     * @brief A process-wide pool, with one worker per hardware thread, started
+     * on first use.
+     */
+    static ThreadPool &global()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Runs `func` on a worker and waits for it, rethrowing what it
+     * throws. On a worker of this pool, it simply calls `func`.
+     */
+    template<typename F>
+    std::invoke_result_t<F &> install(F &&func)
+    {
+        if (current_worker().pool == this)
+            return func();
+
+        detail::StackJob<std::remove_reference_t<F> &> job(func, true);
+        this->push(&job);
+        job.latch.wait();
+
+        return job.take();
+    }
+
+    /**
+     * @brief Runs `a` and `b`, potentially in parallel, returning both
+     * results. Whatever either of them throws is rethrown once both are done.
+     */
+    template<typename A, typename B>
+    std::pair<std::invoke_result_t<A &>, std::invoke_result_t<B &>>
+    join(A &&a, B &&b)
+    {
+        using RA = std::invoke_result_t<A &>;
+        using RB = std::invoke_result_t<B &>;
+        static_assert(!std::is_void_v<RA> && !std::is_void_v<RB>,
+                      "join() needs functions returning a value.");
+
+        Current &current = current_worker();
+        if (current.pool != this)
+            return this->install([&]() { return this->join(a, b); });
+
+        detail::StackJob<std::remove_reference_t<B> &> job_b(b, false);
+        this->push(&job_b);
+
+        Maybe<RA>          ra;
+        std::exception_ptr error;
+        try {
+            ra.insert(a());
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        // Everything `a` pushed is gone by now, so `b` is either at the bottom
+        // of the deque or being run by a thief.
+        while (!job_b.latch.probe()) {
+            detail::Job *job = this->find_job(current);
+
+            if (job == &job_b) {
+                if (error)
+                    std::rethrow_exception(error);
+
+                RB rb = b();
+                return { ra.unwrap(), std::move(rb) };
+            }
+
+            if (job != nullptr)
+                job->execute(job);
+            else
+                std::this_thread::yield();
+        }
+
+        if (error)
+            std::rethrow_exception(error);
+
+        RB rb = job_b.take();
+        return { ra.unwrap(), std::move(rb) };
+    }
+
+    /**
+     * @brief Runs `func` in the background. If it throws, joining the handle
+     * gives the exception back as a `Panic`.
+     */
+    template<typename F>
+    JoinHandle<std::invoke_result_t<std::decay_t<F> &>> spawn(F &&func)
+    {
+        using T = std::invoke_result_t<std::decay_t<F> &>;
+
+        auto state = std::make_shared<detail::SpawnState<T>>();
+        this->push(new detail::HeapJob<std::decay_t<F>, T>(
+            std::forward<F>(func), state));
+
+        return JoinHandle<T>(*this, std::move(state));
+    }
+};
+
+/**
+ * @brief Handle to a task started with `ThreadPool::spawn`. Dropping it
+ * detaches the task, which still runs.
+ */
+template<typename T>
+class JoinHandle
+{
+  private:
+    ThreadPool                            *pool;
+    std::shared_ptr<detail::SpawnState<T>> state;
+
+    JoinHandle(ThreadPool &pool, std::shared_ptr<detail::SpawnState<T>> state)
+        : pool(&pool)
+        , state(std::move(state))
+    {
+    }
+
+  public:
+    friend class ThreadPool;
+
+    /**
+     * @brief Whether the task is done (and `join` would not wait).
+     */
+    inline bool is_finished() const
+    {
+        return this->state != nullptr && this->state->latch.probe();
+    }
+
+    /**
+     * @brief Waits for the task, giving back what it returned, or what it
+     * threw as a `Panic`. From a worker of the pool, runs other jobs meanwhile.
+     *
+     * @exception std::runtime_error Thrown if the handle was already joined.
+     */
+    Result<T, Panic> join()
+    {
+        if (this->state == nullptr)
+            throw std::runtime_error("Called .join() on a joined JoinHandle");
+
+        auto state = std::move(this->state);
+        this->pool->wait(state->latch);
+
+        if (state->panic.is_some())
+            return Err(state->panic.unwrap());
+
+        if constexpr (std::is_void_v<T>)
+            return Ok();
+        else
+            return Ok(state->output.unwrap());
+    }
+};
+}
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <string_view>
 
 #define fnptr(fn, ...) (*fn)(__VA_ARGS__)
 
@@ -19,6 +20,8 @@
 typedef char const *str;
 /// @brief A modifiable string (char *) type.
 typedef char *ncstr;
+/// @brief A non-owning, read-only string view (std::string_view) type.
+typedef std::string_view strview;
 
 #if !defined(CY_SHORT_TYPENAMES)
 /// @brief The 8-bit unsigned integer type.
@@ -0,0 +1,303 @@
+/**
+ * @file varint.hpp
+ * @author Jesús Blanco
+ * @brief LEB128 varint and zigzag encoding, with a fast bulk decoder.
+ * @version 1.0.0
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) Jesús Blanco. See LICENSE for details.
+ *
+ */
+
+#pragma once
+
+#include "safety.hpp"
+#include "span.hpp"
+#include "types.hpp"
+#include <cstring>
+
+namespace cy {
+/**
+ * @brief The most bytes a varint of a 64-bit value takes.
+ */
+constexpr usize MAX_VARINT_LEN = 10;
+
+/**
+ * @brief Why a varint could not be decoded.
+ */
+struct DecodeError
+{
+    enum Kind : uint8
+    {
+        /// @brief The input ended in the middle of a varint.
+        Truncated,
+        /// @brief The varint is longer than its type allows (10 bytes for 64
+        /// bits, 5 for 32), or its value doesn't fit.
+        Overlong,
+        /// @brief `decode_all` ran out of room for values.
+        OutputFull,
+    };
+
+    Kind kind;
+    /// @brief Offset, in the input, of the varint that failed.
+    usize offset;
+};
+
+/**
+ * @brief A decoded value and how many bytes it took.
+ */
+template<typename T>
+struct Decoded
+{
+    T     value;
+    usize len;
+};
+
+/**
+ * @brief Maps signed values to unsigned ones so that small magnitudes stay
+ * small: 0, -1, 1, -2... become 0, 1, 2, 3...
+ */
+constexpr uint64 zigzag(int64 value)
+{
+    return (static_cast<uint64>(value) << 1) ^
+           static_cast<uint64>(value >> 63);
+}
+
+/**
+ * @see zigzag
+ */
+constexpr int64 unzigzag(uint64 value)
+{
+    return static_cast<int64>(value >> 1) ^ -static_cast<int64>(value & 1);
+}
+
+/**
+ * @brief Writes `value` as a varint to `out`, which must have room for
+ * `MAX_VARINT_LEN` bytes.
+ *
+ * @return The number of bytes written.
+ */
+inline usize encode_varint(uint64 value, uint8 *out)
+{
+    usize len = 0;
+    while (value >= 0x80) {
+        out[len++] = static_cast<uint8>(value | 0x80);
+        value >>= 7;
+    }
+
+    out[len++] = static_cast<uint8>(value);
+    return len;
+}
+
+/**
+ * @brief Writes a signed `value` as the varint of its `zigzag`.
+ */
+inline usize encode_zigzag(int64 value, uint8 *out)
+{
+    return encode_varint(zigzag(value), out);
+}
+
+namespace detail {
+/**
+ * @brief Decodes one varint of at most `max_len` bytes, one byte at a time.
+ * `offset` only goes into errors.
+ */
+inline Result<Decoded<uint64>, DecodeError> decode_varint_at(
+    uint8 const *bytes,
+    usize        len,
+    usize        max_len,
+    usize        offset)
+{
+    uint64 value = 0;
+    for (usize i = 0; i < len; i++) {
+        if (i == max_len)
+            return Err(DecodeError{ DecodeError::Overlong, offset });
+
+        uint64 byte = bytes[i];
+        value |= (byte & 0x7f) << (7 * i);
+
+        if (byte < 0x80) {
+            // The last byte of a 64-bit varint only has room for 1 bit.
+            if (i == MAX_VARINT_LEN - 1 && byte > 1)
+                return Err(DecodeError{ DecodeError::Overlong, offset });
+
+            return Ok(Decoded<uint64>{ value, i + 1 });
+        }
+    }
+
+    if (len >= max_len)
+        return Err(DecodeError{ DecodeError::Overlong, offset });
+
+    return Err(DecodeError{ DecodeError::Truncated, offset });
+}
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+constexpr bool LITTLE_ENDIAN_WORDS = true;
+#else
+constexpr bool LITTLE_ENDIAN_WORDS = false;
+#endif
+
+constexpr uint64 HIGH_BITS = 0x8080808080808080;
+/// @brief Stop bits of a word holding four two-byte varints.
+constexpr uint64 TWO_BYTE_STOPS = 0x8000800080008000;
+
+/**
+ * @brief Index of the lowest set bit in `value`, which must not be 0.
+ */
+inline usize lowest_bit(uint64 value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<usize>(__builtin_ctzll(value));
+#else
+    usize bit = 0;
+    while ((value & 1) == 0) {
+        value >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+/**
+ * @brief Packs the low 7 bits of each byte of `word` into its low 56 bits,
+ * in three steps of shifts and masks instead of one per byte.
+ */
+constexpr uint64 pack_varint_word(uint64 word)
+{
+    word = ((word & 0x7f007f007f007f00) >> 1) | (word & 0x007f007f007f007f);
+    word = ((word & 0x3fff00003fff0000) >> 2) | (word & 0x00003fff00003fff);
+    word = ((word & 0x0fffffff00000000) >> 4) | (word & 0x000000000fffffff);
+    return word;
+}
+}
+
+/**
+ * @brief Decodes the varint at the start of `bytes`.
+ */
+inline Result<Decoded<uint64>, DecodeError> decode_varint(
+    Span<uint8 const> bytes)
+{
+    return detail::decode_varint_at(
+        bytes.data(), bytes.len(), MAX_VARINT_LEN, 0);
+}
+
+/**
+ * @brief Decodes the varint at the start of `bytes`, which must fit in 32
+ * bits.
+ */
+inline Result<Decoded<uint32>, DecodeError> decode_varint32(
+    Span<uint8 const> bytes)
+{
+    auto result = detail::decode_varint_at(bytes.data(), bytes.len(), 5, 0);
+    if (result.is_err())
+        return Err(result.unwrap_err());
+
+    Decoded<uint64> decoded = result.unwrap();
+    if (decoded.value > UINT32_MAX)
+        return Err(DecodeError{ DecodeError::Overlong, 0 });
+
+    return Ok(Decoded<uint32>{ static_cast<uint32>(decoded.value),
+                               decoded.len });
+}
+
+/**
+ * @brief Decodes the zigzag varint at the start of `bytes`.
+ */
+inline Result<Decoded<int64>, DecodeError> decode_zigzag(
+    Span<uint8 const> bytes)
+{
+    auto result = decode_varint(bytes);
+    if (result.is_err())
+        return Err(result.unwrap_err());
+
+    Decoded<uint64> decoded = result.unwrap();
+    return Ok(Decoded<int64>{ unzigzag(decoded.value), decoded.len });
+}
+
+/**
+ * @brief Decodes every varint in `bytes` into `out`, in order.
+ *
+ * Whenever 8 bytes are left, they are read as one word: if none of them has
+ * the continuation bit set, that's 8 one-byte values, and if every other one
+ * does, 4 two-byte values; otherwise every varint that ends within the word
+ * is found from its stop bit and unpacked with a few shifts and masks. Only
+ * varints longer than 8 bytes take the byte-at-a-time path.
+ *
+ * @return `Ok` with the number of values decoded, or the first error (without
+ * throwing). `out` holds the values before the error.
+ */
+inline Result<usize, DecodeError> decode_all(Span<uint8 const> bytes,
+                                             Span<uint64>      out)
+{
+    uint8 const *data = bytes.data();
+    usize        len = bytes.len();
+    usize        offset = 0;
+    usize        count = 0;
+
+    while (offset < len) {
+        if (count == out.len())
+            return Err(DecodeError{ DecodeError::OutputFull, offset });
+
+        if constexpr (detail::LITTLE_ENDIAN_WORDS) {
+            if (len - offset >= 8) {
+                uint64 word;
+                std::memcpy(&word, data + offset, 8);
+                uint64 stops = ~word & detail::HIGH_BITS;
+
+                if (stops == detail::HIGH_BITS && out.len() - count >= 8) {
+                    for (usize i = 0; i < 8; i++)
+                        out[count + i] = (word >> (8 * i)) & 0xff;
+
+                    count += 8;
+                    offset += 8;
+                    continue;
+                }
+
+                if (stops == detail::TWO_BYTE_STOPS &&
+                    out.len() - count >= 4) {
+                    for (usize i = 0; i < 4; i++) {
+                        uint64 pair = word >> (16 * i);
+                        out[count + i] =
+                            (pair & 0x7f) | ((pair >> 1) & 0x3f80);
+                    }
+
+                    count += 4;
+                    offset += 8;
+                    continue;
+                }
+
+                if (stops != 0) {
+                    // Each stop bit ends a varint; take every varint that
+                    // ends within the word.
+                    usize start = 0;
+                    while (stops != 0 && count < out.len()) {
+                        usize  stop = detail::lowest_bit(stops);
+                        usize  width = stop + 1 - start;
+                        uint64 mask = width == 64 ? ~uint64(0)
+                                                  : (uint64(1) << width) - 1;
+
+                        out[count++] =
+                            detail::pack_varint_word((word >> start) & mask);
+                        start = stop + 1;
+                        stops &= stops - 1;
+                    }
+
+                    offset += start / 8;
+                    continue;
+                }
+            }
+        }
+
+        auto result = detail::decode_varint_at(
+            data + offset, len - offset, MAX_VARINT_LEN, offset);
+        if (result.is_err())
+            return Err(result.unwrap_err());
+
+        Decoded<uint64> decoded = result.unwrap();
+        out[count++] = decoded.value;
+        offset += decoded.len;
+    }
+
+    return Ok(count);
+}
+}
@@ -0,0 +1,108 @@
+#include "CY/box.hpp"
+#include "CY/safety.hpp"
+#include "CY/types.hpp"
+#include <cassert>
+#include <cstdio>
+#include <memory>
+
+struct Node
+{
+    int32                    value;
+    cy::Maybe<cy::Box<Node>> left;
+    cy::Maybe<cy::Box<Node>> right;
+
+    Node(int32 value)
+        : value(value)
+    {
+    }
+};
+
+int32 Sum(Node const &node)
+{
+    int32 sum = node.value;
+
+    if (node.left.is_some())
+        sum += Sum(node.left.get().get());
+    if (node.right.is_some())
+        sum += Sum(node.right.get().get());
+
+    return sum;
+}
+
+usize allocations = 0;
+usize deallocations = 0;
+
+template<typename T>
+struct CountingAllocator
+{
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template<typename U>
+    CountingAllocator(CountingAllocator<U> const &)
+    {
+    }
+
+    T *allocate(usize n)
+    {
+        allocations++;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *ptr, usize n)
+    {
+        deallocations++;
+        std::allocator<T>().deallocate(ptr, n);
+    }
+};
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "Box-------------------------\n\n");
+
+    static_assert(sizeof(cy::Box<int32>) == sizeof(int32 *));
+    static_assert(sizeof(cy::Maybe<cy::Box<int32>>) == sizeof(int32 *));
+    static_assert(sizeof(cy::Maybe<cy::Box<Node>>) == sizeof(Node *));
+    std::printf("sizeof(Maybe<Box<T>>) == %zu succeeded!\n",
+                sizeof(cy::Maybe<cy::Box<Node>>));
+
+    auto boxed = cy::make_box<int32>(42);
+    assert(*boxed == 42);
+    *boxed += 1;
+    assert(boxed.get() == 43);
+
+    cy::Maybe<cy::Box<int32>> none;
+    assert(none.is_none());
+
+    cy::Maybe<cy::Box<int32>> some = cy::Some(std::move(boxed));
+    assert(some.is_some() && some.get().get() == 43);
+
+    auto recovered = some.unwrap();
+    assert(*recovered == 43);
+    assert(some.is_none()); // moved-from Box is the niche.
+
+    Node root(1);
+    root.left = cy::Some(cy::make_box<Node>(2));
+    root.right = cy::Some(cy::make_box<Node>(3));
+    root.left.get()->left = cy::Some(cy::make_box<Node>(4));
+    assert(root.right.get()->left.is_none());
+    assert(Sum(root) == 10);
+    std::printf("Sum(tree) == %i succeeded!\n", Sum(root));
+
+    {
+        auto counted = cy::allocate_box<int32>(CountingAllocator<int32>(), 7);
+        static_assert(sizeof(counted) == sizeof(int32 *));
+        assert(*counted == 7 && allocations == 1);
+
+        auto moved = std::move(counted);
+        assert(*moved == 7);
+    }
+    assert(allocations == 1 && deallocations == 1);
+    std::printf("%zu allocation(s) == %zu deallocation(s) succeeded!\n",
+                allocations,
+                deallocations);
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
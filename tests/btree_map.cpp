@@ -0,0 +1,173 @@
+#include "CY/btree_map.hpp"
+#include "CY/safety.hpp"
+#include "CY/types.hpp"
+#include <cassert>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+template<typename K, typename V>
+void AssertSame(cy::BTreeMap<K, V> const &map, std::map<K, V> const &expected)
+{
+    assert(map.len() == expected.size());
+
+    auto it = expected.begin();
+    map.iter().fold(0, [&](int32, auto entry) {
+        assert(it != expected.end());
+        assert(entry.first == it->first && entry.second == it->second);
+        ++it;
+        return 0;
+    });
+    assert(it == expected.end());
+}
+
+template<typename I>
+usize Count(I iter)
+{
+    return iter.fold(usize(0), [](usize n, auto) { return n + 1; });
+}
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "BTreeMap-------------------------\n\n");
+
+    cy::BTreeMap<int64, std::string> names;
+    assert(names.is_empty() && names.get(1).is_none());
+    assert(names.first().is_none() && names.last().is_none());
+    auto nothing = names.remove(1);
+    assert(nothing.is_none());
+
+    auto two = names.insert(2, "two");
+    auto one = names.insert(1, "one");
+    auto three = names.insert(3, "three");
+    assert(two.is_none() && one.is_none() && three.is_none());
+    auto replaced = names.insert(2, "TWO");
+    assert(replaced.get() == "two");
+    assert(names.len() == 3 && names.get(2).get() == "TWO");
+
+    names.get(1).get() += "!";
+    assert(names.get(1).get() == "one!");
+    assert(names.contains(3) && !names.contains(4));
+
+    assert(names.first().get().first == 1);
+    assert(names.last().get().second == "three");
+    std::printf("get and insert succeeded!\n");
+
+    auto removed = names.remove(2);
+    assert(removed.get() == "TWO");
+    removed = names.remove(2);
+    assert(removed.is_none() && names.len() == 2);
+    one = names.remove(1);
+    three = names.remove(3);
+    assert(one.is_some() && three.is_some());
+    assert(names.is_empty() && names.first().is_none());
+    std::printf("remove succeeded!\n");
+
+    // Random inserts and removes across many node splits and merges.
+    std::mt19937_64          random(42);
+    cy::BTreeMap<int64, int64> map;
+    std::map<int64, int64>     expected;
+    for (int32 i = 0; i < 20000; i++) {
+        int64 key = static_cast<int64>(random() % 5000);
+        if (random() % 3 == 0) {
+            auto removed = map.remove(key);
+            auto found = expected.find(key);
+            assert(removed.is_some() == (found != expected.end()));
+            if (removed.is_some()) {
+                assert(removed.unwrap() == found->second);
+                expected.erase(found);
+            }
+        } else {
+            map.insert(key, i);
+            expected[key] = i;
+        }
+    }
+    AssertSame(map, expected);
+    for (int64 key = 0; key < 5000; key++)
+        assert(map.get(key).is_some() == (expected.count(key) == 1));
+
+    for (auto const &[key, value] : expected) {
+        auto removed = map.remove(key);
+        assert(removed.get() == value);
+    }
+    assert(map.is_empty());
+    std::printf("Random inserts and removes succeeded!\n");
+
+    // Keys coming in order fill leaves up.
+    for (int64 key = 0; key < 10000; key++)
+        map.insert(key, key * 2);
+    assert(map.len() == 10000 && map.last().get().first == 9999);
+
+    int64 sum = map.range(100, 200).fold(
+        int64(0), [](int64 acc, auto entry) { return acc + entry.second; });
+    assert(sum == 2 * (100 + 199) * 100 / 2);
+
+    auto range = map.range(9998, 20000);
+    auto first = range.next();
+    auto second = range.next();
+    auto end = range.next();
+    assert(first.get().first == 9998 && second.get().first == 9999);
+    assert(end.is_none());
+    assert(map.range(20000, 30000).next().is_none());
+    assert(map.range(50, 50).next().is_none());
+    assert(map.range(60, 50).next().is_none());
+    assert(Count(map.range(-5, 2)) == 2);
+
+    map.iter().fold(0, [](int32, auto entry) {
+        entry.second = 0;
+        return 0;
+    });
+    assert(map.get(500).unwrap() == 0);
+    std::printf("Range scans succeeded!\n");
+
+    std::vector<std::pair<int64, std::string>> sorted;
+    for (int64 key = 0; key < 3000; key += 3)
+        sorted.emplace_back(key, std::to_string(key));
+
+    auto loaded = cy::BTreeMap<int64, std::string>::from_sorted(
+        sorted.begin(), sorted.end());
+    std::map<int64, std::string> loaded_expected(sorted.begin(), sorted.end());
+    AssertSame(loaded, loaded_expected);
+    assert(loaded.get(2997).get() == "2997" && loaded.get(2998).is_none());
+
+    // Still a valid tree to insert into and remove from.
+    for (int64 key = 1; key < 3000; key += 3) {
+        loaded.insert(key, "x");
+        loaded_expected[key] = "x";
+    }
+    for (int64 key = 0; key < 3000; key += 6) {
+        auto removed = loaded.remove(key);
+        assert(removed.is_some());
+        loaded_expected.erase(key);
+    }
+    AssertSame(loaded, loaded_expected);
+
+    sorted.emplace_back(0, "out of order");
+    bool threw = false;
+    try {
+        (void)cy::BTreeMap<int64, std::string>::from_sorted(sorted.begin(),
+                                                             sorted.end());
+    } catch (std::invalid_argument const &) {
+        threw = true;
+    }
+    assert(threw);
+    std::printf("from_sorted succeeded!\n");
+
+    cy::BTreeMap<std::string, int32> words;
+    for (auto word : { "pear", "apple", "fig", "banana", "cherry" })
+        words.insert(word, static_cast<int32>(std::string(word).size()));
+    assert(words.first().get().first == "apple");
+    assert(Count(words.range("b", "d")) == 2);
+
+    cy::BTreeMap<std::string, int32> moved = std::move(words);
+    assert(moved.len() == 5 && words.is_empty());
+    assert(moved.get("fig").unwrap() == 3);
+    std::printf("String keys succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
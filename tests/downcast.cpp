@@ -0,0 +1,109 @@
+#include "CY/downcast.hpp"
+#include "CY/safety.hpp"
+#include "CY/types.hpp"
+#include <cassert>
+#include <cstdio>
+
+class Message : public cy::Downcastable
+{
+  public:
+    usize seq;
+
+    Message(usize seq)
+        : seq(seq)
+    {
+    }
+
+    virtual ~Message() = default;
+};
+
+class Ping : public cy::Subclass<Ping, Message>
+{
+  public:
+    Ping(usize seq)
+        : Subclass(seq)
+    {
+    }
+};
+
+class LoudPing : public cy::Subclass<LoudPing, Ping>
+{
+  public:
+    usize volume;
+
+    LoudPing(usize seq, usize volume)
+        : Subclass(seq)
+        , volume(volume)
+    {
+    }
+};
+
+class Pong : public cy::Subclass<Pong, Message>
+{
+  public:
+    Pong(usize seq)
+        : Subclass(seq)
+    {
+    }
+};
+
+// Not registered: only reachable through dynamic_cast.
+class QuietPing : public Ping
+{
+  public:
+    QuietPing(usize seq)
+        : Ping(seq)
+    {
+    }
+};
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "Downcast-------------------------\n\n");
+
+    Ping      ping(1);
+    LoudPing  loud(2, 11);
+    Pong      pong(3);
+    QuietPing quiet(4);
+
+    Message &as_ping = ping;
+    Message &as_loud = loud;
+    Message &as_pong = pong;
+    Message &as_quiet = quiet;
+
+    assert(cy::downcast<Ping>(as_ping).unwrap().seq == 1);
+    assert(cy::downcast<LoudPing>(as_ping).is_none());
+    assert(cy::downcast<Pong>(as_ping).is_none());
+    std::printf("Exact class succeeded!\n");
+
+    assert(cy::downcast<Ping>(as_loud).unwrap().seq == 2);
+    assert(cy::downcast<LoudPing>(as_loud).unwrap().volume == 11);
+    assert(cy::downcast<Pong>(as_loud).is_none());
+    assert(cy::downcast<Ping>(as_pong).is_none());
+    std::printf("Deeper hierarchy succeeded!\n");
+
+    assert(cy::downcast<Ping>(as_quiet).unwrap().seq == 4);
+    assert(cy::downcast<QuietPing>(as_quiet).unwrap().seq == 4);
+    assert(cy::downcast<QuietPing>(as_ping).is_none());
+    std::printf("dynamic_cast fallback succeeded!\n");
+
+    Message const &constant = loud;
+    auto           maybe = cy::downcast<LoudPing>(constant);
+    static_assert(
+        std::is_same_v<decltype(maybe), cy::Maybe<LoudPing const &>>);
+    assert(maybe.unwrap().volume == 11);
+
+    Ping sliced = loud;
+    assert(cy::downcast<LoudPing>(static_cast<Message &>(sliced)).is_none());
+    ping = loud;
+    assert(cy::downcast<LoudPing>(as_ping).is_none());
+    assert(ping.seq == 2);
+    std::printf("Copies keep their own class succeeded!\n");
+
+    // Moves stay noexcept, so containers move rather than copy on growth.
+    static_assert(std::is_nothrow_move_constructible_v<LoudPing>);
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
@@ -0,0 +1,253 @@
+#include "CY/epoch.hpp"
+#include "CY/safety.hpp"
+#include "CY/types.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief A node counting the live ones, scribbling over itself when freed.
+ */
+struct Node
+{
+    static inline std::atomic<int64> alive{ 0 };
+
+    uint64 value;
+    Node  *next = nullptr;
+
+    explicit Node(uint64 value)
+        : value(value)
+    {
+        alive++;
+    }
+
+    ~Node()
+    {
+        value = ~uint64(0);
+        alive--;
+    }
+};
+
+/**
+ * @brief A Treiber stack, freeing popped nodes through the collector.
+ */
+class Stack
+{
+  private:
+    std::atomic<Node *> head{ nullptr };
+
+  public:
+    ~Stack()
+    {
+        for (Node *node = this->head.load(); node != nullptr;) {
+            Node *next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    void push(uint64 value)
+    {
+        Node *node = new Node(value);
+        node->next = this->head.load(std::memory_order_relaxed);
+        while (!this->head.compare_exchange_weak(
+            node->next, node, std::memory_order_release)) {
+        }
+    }
+
+    cy::Maybe<uint64> pop()
+    {
+        auto  guard = cy::Collector::global().pin();
+        Node *node = this->head.load(std::memory_order_acquire);
+        while (node != nullptr &&
+               !this->head.compare_exchange_weak(
+                   node, node->next, std::memory_order_acquire)) {
+        }
+
+        if (node == nullptr)
+            return cy::None();
+
+        uint64 value = node->value;
+        cy::Collector::global().retire(node);
+        return cy::Some(value);
+    }
+
+    /**
+     * @brief Walks the top `depth` nodes, which may be popped and retired
+     * meanwhile, but not freed. Returns false if it saw a freed one.
+     */
+    bool walk(usize depth)
+    {
+        auto  guard = cy::Collector::global().pin();
+        Node *node = this->head.load(std::memory_order_acquire);
+        for (usize i = 0; i < depth && node != nullptr; i++) {
+            if (node->value == ~uint64(0))
+                return false;
+            node = node->next;
+        }
+
+        return true;
+    }
+};
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "Collector-------------------------\n\n");
+
+    cy::Collector &collector = cy::Collector::global();
+    constexpr usize BATCH = cy::Collector::RETIRE_BATCH;
+
+    for (usize i = 0; i + 1 < BATCH; i++)
+        collector.retire(new Node(i));
+    assert(collector.pending() == BATCH - 1);
+    assert(Node::alive.load() == static_cast<int64>(BATCH - 1));
+
+    // The batch is full: nothing is pinned, so all of it goes.
+    collector.retire(new Node(BATCH));
+    assert(collector.pending() == 0);
+    assert(Node::alive.load() == 0);
+    std::printf("Retired nodes are freed in batches, succeeded!\n");
+
+    std::thread([&]() {
+        for (usize i = 0; i < 5; i++)
+            collector.retire(new Node(i));
+    }).join();
+    assert(collector.pending() == 5);
+
+    // The thread left its bag behind; a full batch goes over it too.
+    for (usize i = 0; i < BATCH; i++)
+        collector.retire(new Node(i));
+    assert(collector.pending() == 0);
+    assert(Node::alive.load() == 0);
+    std::printf("Bags of exited threads are freed by retire, succeeded!\n");
+
+    {
+        auto guard = collector.pin();
+        for (usize i = 0; i < 3 * BATCH; i++)
+            collector.retire(new Node(i));
+
+        // Pinned, so the epoch can move at most once: nothing is freed.
+        usize freed = collector.collect();
+        assert(freed == 0);
+        assert(Node::alive.load() == static_cast<int64>(3 * BATCH));
+    }
+    usize freed = collector.collect();
+    assert(freed == 3 * BATCH);
+    assert(Node::alive.load() == 0);
+    std::printf("Pinned threads hold garbage back, succeeded!\n");
+
+    {
+        std::atomic<Node *> shared{ new Node(1) };
+        auto                guard = collector.protect(shared).unwrap();
+        assert(guard->value == 1);
+
+        Node *old = shared.exchange(new Node(2));
+        collector.retire(old);
+        for (usize i = 0; i < 4; i++)
+            collector.collect();
+
+        // Epochs went by, but the hazard pointer keeps the node.
+        uint64 before = collector.current_epoch();
+        assert(collector.pending() == 1);
+        assert(guard->value == 1);
+
+        {
+            auto moved = std::move(guard);
+            assert(moved.get() == old);
+        }
+        freed = collector.collect();
+        assert(freed == 1);
+        assert(collector.current_epoch() >= before);
+
+        delete shared.exchange(nullptr);
+        auto missing = collector.protect(shared);
+        assert(missing.is_none());
+        assert(Node::alive.load() == 0);
+    }
+    std::printf("Hazard pointers outlive epochs, succeeded!\n");
+
+    {
+        constexpr usize  THREADS = 4;
+        constexpr uint64 OPS = 20000;
+
+        Stack               stack;
+        std::atomic<uint64> popped_sum{ 0 };
+        std::atomic<uint64> popped{ 0 };
+
+        std::atomic<Node *> latest{ new Node(0) };
+
+        std::vector<std::thread> threads;
+        for (usize t = 0; t < THREADS; t++) {
+            threads.emplace_back([&, t]() {
+                uint64 sum = 0;
+                uint64 count = 0;
+                for (uint64 i = 0; i < OPS; i++) {
+                    if (t == 0 && i % 16 == 0)
+                        collector.retire(latest.exchange(new Node(i)));
+
+                    stack.push(t * OPS + i);
+                    if (i % 3 != 2) {
+                        auto value = stack.pop();
+                        if (value.is_some()) {
+                            sum += value.unwrap();
+                            count++;
+                        }
+                    }
+                }
+                popped_sum += sum;
+                popped += count;
+            });
+        }
+
+        // Pinned readers walking the stack, and a reader holding on to
+        // `latest` with a hazard pointer while it is replaced.
+        std::atomic<bool> done{ false };
+        std::thread       walker([&]() {
+            while (!done.load()) {
+                bool ok = stack.walk(8);
+                assert(ok);
+                std::this_thread::yield();
+            }
+        });
+        std::thread holder([&]() {
+            while (!done.load()) {
+                auto   guard = collector.protect(latest).unwrap();
+                uint64 value = guard->value;
+                for (usize i = 0; i < 64; i++) {
+                    std::this_thread::yield();
+                    assert(guard->value == value);
+                }
+            }
+        });
+
+        for (auto &thread : threads)
+            thread.join();
+        done.store(true);
+        walker.join();
+        holder.join();
+        collector.retire(latest.exchange(nullptr));
+
+        uint64 rest_sum = 0;
+        uint64 rest = 0;
+        for (auto value = stack.pop(); value.is_some(); value = stack.pop()) {
+            rest_sum += value.unwrap();
+            rest++;
+        }
+
+        uint64 total = THREADS * OPS;
+        assert(popped.load() + rest == total);
+        assert(popped_sum.load() + rest_sum == total * (total - 1) / 2);
+
+        // The threads left their bags behind when they exited.
+        collector.collect();
+        assert(collector.pending() == 0);
+        assert(Node::alive.load() == 0);
+    }
+    std::printf("Treiber stack stress succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
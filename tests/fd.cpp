@@ -0,0 +1,75 @@
+#include "CY/fd.hpp"
+#include "CY/safety.hpp"
+#include "CY/types.hpp"
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/socket.h>
+
+bool IsOpen(int32 fd) { return ::fcntl(fd, F_GETFD) != -1; }
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "Fd-------------------------\n\n");
+
+    static_assert(sizeof(cy::Fd) == 4);
+    static_assert(sizeof(cy::Maybe<cy::Fd>) == 4);
+    static_assert(sizeof(cy::Result<cy::Fd, cy::Errno>) == 8);
+
+    auto missing = cy::Fd::open("/this/path/does/not/exist", O_RDONLY);
+    assert(missing.is_err() && missing.get_err() == cy::Errno{ ENOENT });
+    std::printf("[OK, expected] open() responded with: %s\n",
+                missing.get_err().message());
+
+    int32 raw;
+    {
+        auto null = cy::Fd::open("/dev/null", O_RDONLY | O_CLOEXEC).unwrap();
+        raw = null.raw();
+        assert(IsOpen(raw));
+
+        auto moved = std::move(null);
+        assert(moved.raw() == raw && null.raw() == -1);
+
+        cy::Maybe<cy::Fd> maybe = cy::Some(std::move(moved));
+        assert(maybe.is_some() && IsOpen(raw));
+    }
+    assert(!IsOpen(raw));
+    std::printf("Descriptor %i closed once after moves, succeeded!\n", raw);
+
+    cy::Maybe<cy::Fd> none;
+    assert(none.is_none());
+
+    auto pair = cy::Fd::socketpair(AF_UNIX, SOCK_STREAM).unwrap();
+    usize wrote = pair.first.write("ping", 4).unwrap();
+    assert(wrote == 4);
+
+    char  buffer[8] = {};
+    usize read = pair.second.read(buffer, sizeof(buffer)).unwrap();
+    assert(read == 4);
+    assert(std::strcmp(buffer, "ping") == 0);
+
+#if defined(__linux__)
+    auto memfd = cy::Fd::memfd_create("cy-test").unwrap();
+    wrote = memfd.write("data", 4).unwrap();
+    assert(wrote == 4);
+    auto copy = memfd.try_clone().unwrap();
+    assert(copy.raw() != memfd.raw());
+    auto closed = std::move(copy).close();
+    assert(closed.is_ok());
+
+    auto   event = cy::Fd::eventfd(0).unwrap();
+    uint64 count = 3;
+    wrote = event.write(&count, sizeof(count)).unwrap();
+    assert(wrote == sizeof(count));
+    count = 0;
+    read = event.read(&count, sizeof(count)).unwrap();
+    assert(read == sizeof(count));
+    assert(count == 3);
+#endif
+    std::printf("socketpair, memfd_create and eventfd succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include "CY/format.hpp"
+#include "CY/safety.hpp"
+#include "CY/types.hpp"
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+struct Vec2
+{
+    float64 x;
+    float64 y;
+};
+
+template<>
+struct cy::Formatter<Vec2>
+{
+    static void write(cy::FormatWriter &out, Vec2 const &value)
+    {
+        out.put('(');
+        out.format(value.x);
+        out.write(", ");
+        out.format(value.y);
+        out.put(')');
+    }
+};
+
+cy::Result<int32, str> Parse(str input)
+{
+    if (input[0] < '0' || input[0] > '9')
+        return cy::Err("not a digit");
+
+    return cy::Ok(input[0] - '0');
+}
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "Format-------------------------\n\n");
+
+    char buffer[128];
+
+    auto written = cy::format_to(buffer, "answer = ", 42, ", pi = ", 3.5);
+    assert(written.is_ok());
+    assert(std::strcmp(buffer, "answer = 42, pi = 3.5") == 0);
+    assert(written.get() == std::strlen(buffer));
+    std::printf("%s\n", buffer);
+
+    auto some = cy::Maybe<int32>(cy::Some(-7));
+    auto none = cy::Maybe<int32>(cy::None());
+    auto ok = Parse("8");
+    auto err = Parse("x");
+    (void)cy::format_to(buffer, some, " ", none, " ", ok, " ", err);
+    assert(std::strcmp(buffer, "Some(-7) None Ok(8) Err(not a digit)") == 0);
+    std::printf("%s\n", buffer);
+
+    std::string              nested_str = "nested";
+    cy::Maybe<std::string &> nested = cy::Some<std::string &>(nested_str);
+    cy::Result<void, uint8>  unit = cy::Ok();
+    Vec2                     vec = { 1, 2 };
+    (void)cy::format_to(buffer, nested, " ", unit, " ", true, " ", vec);
+    assert(std::strcmp(buffer, "Some(nested) Ok true (1, 2)") == 0);
+    std::printf("%s\n", buffer);
+
+    // Char arrays stop at their first NUL, or are written whole without one.
+    char name[16] = "bob";
+    char raw[3] = { 'a', 'b', 'c' };
+    auto named = cy::format_to(buffer, "[", name, "] ", raw);
+    assert(named.is_ok() && named.get() == 9);
+    assert(std::strcmp(buffer, "[bob] abc") == 0);
+    std::printf("%s\n", buffer);
+
+    char small[8];
+    auto truncated = cy::format_to(small, "0123456789");
+    assert(truncated.is_err());
+    assert(truncated.get_err().written == 7);
+    assert(std::strcmp(small, "0123456") == 0);
+
+    auto number = cy::format_to({ small, sizeof(small) }, "ab", 123456789);
+    assert(number.is_err() && std::strcmp(small, "ab12345") == 0);
+    std::printf("Truncated output kept \"%s\", succeeded!\n", small);
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include "CY/histogram.hpp"
+#include "CY/types.hpp"
+#include <cassert>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "Histogram-------------------------\n\n");
+
+    using Buckets = cy::detail::HistogramBuckets;
+
+    for (uint64 value : { 0ull, 1ull, 127ull, 128ull, 1000ull, 123456789ull }) {
+        usize  index = Buckets::index_of(value);
+        uint64 highest = Buckets::highest_of(index);
+
+        assert(highest >= value);
+        assert(highest - value <= value / Buckets::SUB_COUNT);
+        assert(index == 0 || Buckets::highest_of(index - 1) < value);
+    }
+    assert(Buckets::index_of(~0ull) == Buckets::COUNT - 1);
+    std::printf("Bucket relative error under 1%%, succeeded!\n");
+
+    cy::Histogram empty(1);
+    assert(empty.snapshot().count() == 0);
+    assert(empty.snapshot().percentile(50).is_none());
+    assert(empty.snapshot().max().is_none());
+
+    cy::Histogram histogram(4);
+
+    std::vector<std::thread> threads;
+    for (uint64 t = 0; t < 4; t++) {
+        threads.emplace_back([&histogram, t]() {
+            for (uint64 value = t + 1; value <= 10000; value += 4)
+                histogram.record(value);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    cy::HistogramSnapshot snapshot = histogram.snapshot();
+    assert(snapshot.count() == 10000);
+    assert(snapshot.max().unwrap() == 10000);
+
+    uint64 p50 = snapshot.percentile(50).unwrap();
+    uint64 p99 = snapshot.percentile(99).unwrap();
+    uint64 p999 = snapshot.percentile(99.9).unwrap();
+    assert(p50 >= 5000 && p50 <= 5000 + 5000 / 128);
+    assert(p99 >= 9900 && p99 <= 9900 + 9900 / 128);
+    assert(p999 >= 9990 && p999 <= 10000);
+    assert(snapshot.percentile(100).unwrap() == 10000);
+    std::printf("p50 = %zu, p99 = %zu, p99.9 = %zu, succeeded!\n",
+                static_cast<usize>(p50),
+                static_cast<usize>(p99),
+                static_cast<usize>(p999));
+
+    cy::Histogram other(1);
+    other.record(1000000);
+    snapshot.merge(other.snapshot());
+    assert(snapshot.count() == 10001);
+    assert(snapshot.max().unwrap() == 1000000);
+    std::printf("Merge succeeded!\n");
+
+    histogram.reset();
+    {
+        cy::ScopedTimer timer(histogram);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    assert(histogram.snapshot().count() == 1);
+    assert(histogram.snapshot().max().unwrap() >= 1000000);
+    std::printf("ScopedTimer recorded %zu ns, succeeded!\n",
+                static_cast<usize>(histogram.snapshot().max().unwrap()));
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include "CY/instant.hpp"
+#include "CY/types.hpp"
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "Instant-------------------------\n\n");
+
+    static_assert(cy::Duration::from_millis(3).as_micros() == 3000);
+    static_assert(cy::Duration::from_secs(2).as_nanos() == 2000000000);
+    static_assert((cy::Duration::from_nanos(5) - cy::Duration::from_nanos(9))
+                      .as_nanos() == 0);
+    static_assert(cy::Duration::from_micros(1) < cy::Duration::from_millis(1));
+    std::printf("Duration succeeded!\n");
+
+    cy::Instant::calibrate();
+    cy::Instant first = cy::Instant::now();
+    cy::Instant second = cy::Instant::now();
+    assert(first <= second);
+    assert(first.duration_since(second) == cy::Duration());
+    std::printf("Instants are monotonic (%s), succeeded!\n",
+                cy::Instant::is_tsc() ? "TSC" : "CLOCK_MONOTONIC");
+
+    // The Instant span encloses the steady_clock one, so it can only be
+    // longer, by however long the thread was held up in between.
+    cy::Instant start = cy::Instant::now();
+    auto        chrono_start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    auto         chrono_end = std::chrono::steady_clock::now();
+    cy::Duration elapsed = start.elapsed();
+
+    float64 expected = static_cast<float64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            chrono_end - chrono_start)
+            .count());
+    float64 measured = static_cast<float64>(elapsed.as_nanos());
+    assert(elapsed >= cy::Duration::from_millis(19));
+    assert(measured > expected * 0.95 && measured < expected * 2);
+    std::printf("Measured %llu us of a 20 ms sleep, succeeded!\n",
+                static_cast<unsigned long long>(elapsed.as_micros()));
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
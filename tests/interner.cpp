@@ -0,0 +1,69 @@
+#include "CY/interner.hpp"
+#include "CY/safety.hpp"
+#include "CY/types.hpp"
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "Interner-------------------------\n\n");
+
+    static_assert(sizeof(cy::Maybe<cy::Symbol>) == sizeof(uint32));
+
+    cy::Interner interner;
+
+    auto hello = interner.intern("hello");
+    auto world = interner.intern(std::string("world"));
+    assert(hello != world);
+    auto again = interner.intern("hello");
+    assert(again == hello);
+    assert(interner.resolve(world) == "world");
+    assert(interner.lookup("hello").get() == hello);
+    assert(interner.lookup("nope").is_none());
+
+    strview stored = interner.resolve(hello);
+    for (usize i = 0; i < 100000; i++) {
+        interner.intern(std::to_string(i));
+    }
+    assert(interner.size() == 100002);
+    assert(interner.resolve(hello).data() == stored.data());
+    assert(interner.lookup("99999").get().index() == 100001);
+    std::printf("%zu strings interned, storage stayed put, succeeded!\n",
+                interner.size());
+
+    try {
+        (void)interner.resolve(cy::Symbol(200000));
+    } catch (std::out_of_range &e) {
+        std::printf("[OK, expected] .resolve() responded with: %s\n",
+                    e.what());
+    }
+
+    assert(interner.published().lookup("hello").is_none());
+    interner.publish();
+
+    std::vector<std::thread> readers;
+    for (usize t = 0; t < 4; t++) {
+        readers.emplace_back([&interner]() {
+            for (usize i = 0; i < 100000; i++) {
+                auto const &table = interner.published();
+                auto symbol = table.lookup(std::to_string(i));
+                assert(symbol.is_some());
+                assert(table.resolve(symbol.get()) == std::to_string(i));
+            }
+        });
+    }
+    interner.intern("only after the next publish");
+    for (auto &reader : readers)
+        reader.join();
+
+    assert(interner.published().lookup("only after the next publish")
+               .is_none());
+    std::printf("Concurrent lookups on the published table succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
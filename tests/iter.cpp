@@ -0,0 +1,91 @@
+#include "CY/iter.hpp"
+#include "CY/safety.hpp"
+#include "CY/types.hpp"
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "Iter-------------------------\n\n");
+
+    std::vector<int32> values = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+    auto it = cy::iter(values);
+    assert(it.len() == 8);
+    cy::Maybe<int32 &> first = it.next();
+    assert(first.is_some() && &first.get() == &values[0]);
+    std::printf("next() borrows, succeeded!\n");
+
+    cy::iter(values).next().get() *= 10;
+    assert(values[0] == 10);
+    values[0] = 1;
+
+    auto squares = cy::iter(values)
+                       .filter([](int32 x) { return x % 2 == 0; })
+                       .map([](int32 x) { return x * x; })
+                       .collect();
+    assert((squares == std::vector<int32>{ 4, 16, 36, 64 }));
+    std::printf("filter + map + collect succeeded!\n");
+
+    auto small = cy::iter(values)
+                     .take_while([](int32 x) { return x < 4; })
+                     .collect();
+    assert((small == std::vector<int32>{ 1, 2, 3 }));
+    std::printf("take_while succeeded!\n");
+
+    std::vector<std::string> names = { "a", "b", "c" };
+    auto zipped = cy::iter(names).zip(cy::range(0, 10)).enumerate();
+    usize count = 0;
+    for (auto item = zipped.next(); item.is_some(); item = zipped.next()) {
+        auto [index, pair] = item.unwrap();
+        assert(index == count);
+        assert(&pair.first == &names[index]);
+        assert(pair.second == static_cast<int32>(index));
+        count++;
+    }
+    assert(count == 3);
+    std::printf("zip + enumerate succeeded!\n");
+
+    auto chained = cy::range(0, 3).chain(cy::range(10, 12)).collect();
+    assert((chained == std::vector<int32>{ 0, 1, 2, 10, 11 }));
+    std::printf("chain succeeded!\n");
+
+    int64 sum = cy::range<int64>(0, 1000)
+                    .map([](int64 x) { return x * 2; })
+                    .fold(int64(0), [](int64 acc, int64 x) { return acc + x; });
+    assert(sum == 999000);
+
+    int32 total = cy::iter(values).fold(
+        0, [](int32 acc, int32 const &x) { return acc + x; });
+    assert(total == 36);
+
+    usize weighted =
+        cy::range<usize>(0, 4)
+            .chain(cy::range<usize>(4, 8))
+            .filter([](usize x) { return x % 2 == 1; })
+            .enumerate()
+            .fold(usize(0), [](usize acc, std::pair<usize, usize> item) {
+                return acc + item.first * item.second;
+            });
+    assert(weighted == 0 * 1 + 1 * 3 + 2 * 5 + 3 * 7);
+    std::printf("fold succeeded!\n");
+
+    auto chunks = cy::iter(values);
+    auto chunk = chunks.next_chunk<5>();
+    assert(chunk.is_full() && chunk.items[4] == 5);
+    chunk = chunks.next_chunk<5>();
+    assert(!chunk.is_full() && chunk.len == 3 && chunk.items[2] == 8);
+    auto rest = chunks.next();
+    assert(rest.is_none());
+
+    auto filtered = cy::iter(values).filter([](int32 x) { return x > 6; });
+    auto tail = filtered.next_chunk<4>();
+    assert(tail.len == 2 && tail.items[0] == 7 && tail.items[1] == 8);
+    std::printf("next_chunk succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
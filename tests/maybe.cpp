@@ -4,6 +4,7 @@
 #include <cstdio>
 #include <memory>
 #include <string>
+#include <type_traits>
 
 // #define STATIC_ASSERT_FAIL
 #if defined(STATIC_ASSERT_FAIL)
@@ -71,6 +72,35 @@ cy::Maybe<std::string &> GetString(usize indx)
     return cy::None();
 }
 
+usize constructions = 0;
+usize destructions = 0;
+
+struct Conn
+{
+    std::string peer;
+
+    Conn(std::string peer)
+        : peer(std::move(peer))
+    {
+        constructions++;
+    }
+    Conn(Conn const &other)
+        : peer(other.peer)
+    {
+        constructions++;
+    }
+    Conn(Conn &&other)
+        : peer(std::move(other.peer))
+    {
+        constructions++;
+    }
+    Conn &operator=(Conn const &) = default;
+    Conn &operator=(Conn &&) = default;
+    ~Conn() { destructions++; }
+
+    friend void swap(Conn &a, Conn &b) { a.peer.swap(b.peer); }
+};
+
 int32 main()
 {
     std::printf("\n-----------------------TESTING: "
@@ -102,6 +132,56 @@ int32 main()
     assert(number == other_thing.get());
     std::printf("%i == %.2f succeeded!\n", number, other_thing.get());
 
+    static_assert(std::is_trivially_copyable_v<cy::Maybe<int32>>);
+    static_assert(!std::is_copy_constructible_v<cy::Maybe<Find>>);
+    static_assert(std::is_move_constructible_v<cy::Maybe<Find>>);
+
+    cy::Maybe<Conn> cache;
+    auto &conn = cache.get_or_insert_with([]() { return Conn("a"); });
+    assert(conn.peer == "a" && cache.is_some());
+    assert(&cache.get_or_insert_with([]() { return Conn("b"); }) == &conn);
+
+    // The argument, then the old value moved out; only the argument is
+    // dropped, as the held value is assigned to rather than rebuilt.
+    usize built = constructions;
+    usize dropped = destructions;
+    auto  old = cache.replace(Conn("c"));
+    assert(old.get().peer == "a" && cache.get().peer == "c");
+    assert(&cache.get() == &conn); // moved into the same storage.
+    assert(constructions - built == 2 && destructions - dropped == 1);
+
+    built = constructions;
+    dropped = destructions;
+    cache.insert(Conn("d"));
+    assert(cache.get().peer == "d");
+    assert(constructions - built == 1 && destructions - dropped == 1);
+    std::printf("replace()/insert() assign in place, succeeded!\n");
+
+    auto copy = cache;
+    auto taken = cache.take();
+    assert(cache.is_none() && taken.get().peer == "d");
+    assert(copy.get().peer == "d");
+
+    cache.swap(taken);
+    assert(cache.get().peer == "d" && taken.is_none());
+    built = constructions;
+    dropped = destructions;
+    swap(cache, old);
+    assert(cache.get().peer == "a" && old.get().peer == "d");
+    // Two `Some`s swap their values, without building new ones.
+    assert(constructions == built && destructions == dropped);
+
+    cy::Maybe<Find> moved = FindCharInString(test, 'z');
+    moved = FindCharInString(test, 'e');
+    assert(moved.get().c == 'e');
+    moved = cy::None();
+    assert(moved.is_none());
+
+    cy::Maybe<std::string &> ref = GetString(1);
+    auto                     rebound = ref.replace(test3);
+    assert(&rebound.get() == &test2 && &ref.get() == &test3);
+    assert(&ref.take().get() == &test3 && ref.is_none());
+
     std::printf("\n-----------------------OK-------------------------\n");
     return 0;
 }
\ No newline at end of file
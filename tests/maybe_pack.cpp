@@ -0,0 +1,96 @@
+#include "CY/maybe_pack.hpp"
+#include "CY/safety.hpp"
+#include "CY/types.hpp"
+#include <cassert>
+#include <cstdio>
+
+enum class Color : uint8
+{
+    Red,
+    Green,
+    Blue,
+};
+
+// clang-format off
+using Record = cy::MaybePack<bool, bool, bool, bool, bool, bool, bool, bool,
+                             uint8, uint8, uint8, uint8, uint16, uint16,
+                             Color, Color, uint32, int32, float32, float64>;
+// clang-format on
+
+/**
+ * @brief A trivially copyable field with no default constructor.
+ */
+struct Point
+{
+    int16 x;
+    int16 y;
+
+    constexpr Point(int16 x, int16 y)
+        : x(x)
+        , y(y)
+    {
+    }
+};
+
+struct Unpacked
+{
+    cy::Maybe<bool>    flags[8];
+    cy::Maybe<uint8>   bytes[4];
+    cy::Maybe<uint16>  shorts[2];
+    cy::Maybe<Color>   colors[2];
+    cy::Maybe<uint32>  id;
+    cy::Maybe<int32>   delta;
+    cy::Maybe<float32> ratio;
+    cy::Maybe<float64> score;
+};
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "MaybePack-------------------------\n\n");
+
+    static_assert(sizeof(cy::MaybePack<bool, uint8, uint16>) == 6);
+    static_assert(sizeof(Record) * 3 <= sizeof(Unpacked) * 2);
+    std::printf("sizeof(MaybePack) == %zu, sizeof(Maybe...) == %zu\n",
+                sizeof(Record),
+                sizeof(Unpacked));
+
+    Record record;
+    assert(record.count() == 0 && record.is_none<0>());
+
+    record.set<0>(true);
+    record.set<11>(200);
+    record.set<13>(uint16(60000));
+    record.set<14>(Color::Blue);
+    record.set<19>(2.5);
+    assert(record.count() == 5);
+
+    assert(record.get<0>().get() == true);
+    assert(record.get<1>().is_none());
+    assert(record.get<11>().get() == 200);
+    assert(record.get<13>().get() == 60000);
+    assert(record.get<14>().get() == Color::Blue);
+    assert(record.get<19>().get() == 2.5);
+
+    auto score = record.get_ref<19>();
+    score.get() *= 2;
+    assert(record.get<19>().get() == 5.0);
+
+    auto taken = record.take<11>();
+    assert(taken.get() == 200);
+    assert(record.is_none<11>() && record.count() == 4);
+
+    record.set<16>(cy::Maybe<uint32>(cy::Some<uint32>(7)));
+    record.set<0>(cy::Maybe<bool>());
+    assert(record.get<16>().get() == 7 && record.is_none<0>());
+    std::printf("Packed fields read back, succeeded!\n");
+
+    cy::MaybePack<uint8, Point> points;
+    points.set<1>(Point(3, -4));
+    auto point = points.get<1>();
+    assert(point.get().x == 3 && point.get().y == -4);
+    std::printf("Fields without a default constructor, succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include "CY/packed_int_array.hpp"
+#include "CY/safety.hpp"
+#include "CY/span.hpp"
+#include "CY/types.hpp"
+#include <cassert>
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+
+template<uint32 Bits>
+void CheckUnpack()
+{
+    cy::PackedIntArray<Bits> column(1000);
+    for (usize i = 0; i < column.len(); i++)
+        column.set(i, (i * 0x9e3779b97f4a7c15) & column.max_value());
+
+    std::vector<uint64> out(900);
+    bool                unpacked = column.unpack(37, cy::Span<uint64>(out));
+    assert(unpacked);
+    for (usize i = 0; i < out.size(); i++)
+        assert(out[i] == column.get(37 + i).unwrap());
+}
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "PackedIntArray-------------------------\n\n");
+
+    cy::PackedIntArray<5> days(365);
+    assert(days.len() == 365 && days.bits() == 5 && days.max_value() == 31);
+    assert(days.memory_usage() < 365 * sizeof(uint32) / 4);
+    for (usize i = 0; i < days.len(); i++) {
+        bool set = days.set(i, i % 31);
+        assert(set);
+    }
+    for (usize i = 0; i < days.len(); i++)
+        assert(days.get(i).unwrap() == i % 31);
+
+    assert(days.get(365).is_none());
+    bool out_of_range = days.set(365, 1);
+    bool too_wide = days.set(0, 32);
+    assert(!out_of_range && !too_wide);
+    assert(days.get(0).unwrap() == 0);
+    std::printf("Fixed width get/set succeeded!\n");
+
+    // Every width, with values that straddle words.
+    for (uint32 bits = 1; bits <= 64; bits++) {
+        cy::PackedIntArray<> column(bits, 0);
+        uint64               max = column.max_value();
+        for (uint64 i = 0; i < 200; i++) {
+            bool pushed = column.push((i * 0x9e3779b97f4a7c15) & max);
+            assert(pushed);
+        }
+
+        bool pushed = column.push(bits == 64 ? 0 : max + 1);
+        assert(!pushed || bits == 64);
+        for (uint64 i = 0; i < 200; i++)
+            assert(column.get(i).unwrap() == ((i * 0x9e3779b97f4a7c15) & max));
+    }
+
+    bool thrown = false;
+    try {
+        cy::PackedIntArray<> column(65, 10);
+    } catch (std::invalid_argument const &) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::printf("Runtime widths succeeded!\n");
+
+    std::vector<uint32> out(100);
+    bool                unpacked = days.unpack(200, cy::Span<uint32>(out));
+    assert(unpacked);
+    for (usize i = 0; i < out.size(); i++)
+        assert(out[i] == (200 + i) % 31);
+    unpacked = days.unpack(300, cy::Span<uint32>(out));
+    assert(!unpacked);
+
+    cy::PackedIntArray<> wide(40, 10);
+    wide.set(9, (uint64(1) << 40) - 1);
+    std::vector<uint64> wide_out(10);
+    unpacked = wide.unpack(0, cy::Span<uint32>(out));
+    assert(!unpacked);
+    unpacked = wide.unpack(0, cy::Span<uint64>(wide_out));
+    assert(unpacked);
+    assert(wide_out[9] == (uint64(1) << 40) - 1 && wide_out[8] == 0);
+    CheckUnpack<1>();
+    CheckUnpack<3>();
+    CheckUnpack<20>();
+    CheckUnpack<33>();
+    CheckUnpack<64>();
+    std::printf("Bulk unpack succeeded!\n");
+
+    cy::NullablePackedIntArray<3> levels(8);
+    assert(levels.get(0).is_none());
+    bool set_seven = levels.set(1, 7);
+    bool set_zero = levels.set(2, 0);
+    bool set_eight = levels.set(3, 8);
+    assert(set_seven && set_zero && !set_eight);
+    assert(levels.get(1).unwrap() == 7 && levels.get(2).unwrap() == 0);
+    assert(levels.get(3).is_none() && levels.get(8).is_none());
+    bool cleared = levels.clear(1);
+    assert(cleared && levels.get(1).is_none());
+    bool pushed_some = levels.push(cy::Some<uint64>(5));
+    bool pushed_none = levels.push(cy::None());
+    assert(pushed_some && pushed_none);
+    assert(levels.len() == 10);
+    assert(levels.get(8).unwrap() == 5 && levels.get(9).is_none());
+    assert(levels.validity().get(2).unwrap() == 1);
+    std::printf("Nullable values succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
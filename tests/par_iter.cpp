@@ -0,0 +1,114 @@
+#include "CY/par_iter.hpp"
+#include "CY/safety.hpp"
+#include "CY/thread_pool.hpp"
+#include "CY/types.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+uint64 Fib(cy::ThreadPool &pool, uint64 n)
+{
+    if (n < 2)
+        return n;
+
+    auto [a, b] = pool.join([&]() { return Fib(pool, n - 1); },
+                            [&]() { return Fib(pool, n - 2); });
+    return a + b;
+}
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "ParIter-------------------------\n\n");
+
+    cy::ThreadPool pool(4);
+    assert(pool.size() == 4);
+    assert(cy::ThreadPool::current() == nullptr);
+    auto installed = pool.install([]() { return cy::ThreadPool::current(); });
+    assert(installed == &pool);
+    uint64 fib = Fib(pool, 20);
+    assert(fib == 6765);
+    std::printf("join() succeeded!\n");
+
+    bool thrown = false;
+    try {
+        pool.join([]() -> int32 { throw std::runtime_error("left"); },
+                  []() { return 0; });
+    } catch (std::runtime_error const &) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::printf("join() rethrows, succeeded!\n");
+
+    std::vector<uint64> values(100000);
+    std::iota(values.begin(), values.end(), 0);
+
+    uint64 sum = pool.install([&]() {
+        return cy::par_iter(values).reduce(
+            uint64(0), [](uint64 acc, uint64 x) { return acc + x; });
+    });
+    assert(sum == 99999ull * 100000 / 2);
+
+    uint64 even_squares =
+        cy::par_range<uint64>(0, 1000)
+            .filter([](uint64 x) { return x % 2 == 0; })
+            .map([](uint64 x) { return x * x; })
+            .reduce(uint64(0), [](uint64 acc, uint64 x) { return acc + x; });
+    uint64 expected = 0;
+    for (uint64 x = 0; x < 1000; x += 2)
+        expected += x * x;
+    assert(even_squares == expected);
+    std::printf("reduce succeeded!\n");
+
+    auto strings = cy::par_iter(values)
+                       .filter([](uint64 x) { return x % 1000 == 0; })
+                       .map([](uint64 x) { return std::to_string(x); })
+                       .collect();
+    assert(strings.size() == 100);
+    for (usize i = 0; i < strings.size(); i++)
+        assert(strings[i] == std::to_string(i * 1000));
+    std::printf("collect keeps order, succeeded!\n");
+
+    std::atomic<usize> visited{ 0 };
+    auto ok = cy::par_iter(values).try_for_each(
+        [&](uint64 &x) -> cy::Result<void, std::string> {
+            visited.fetch_add(1, std::memory_order_relaxed);
+            x += 1;
+            return cy::Ok();
+        });
+    assert(ok.is_ok());
+    assert(visited.load() == values.size());
+    assert(values.front() == 1 && values.back() == 100000);
+
+    visited.store(0);
+    auto failed = cy::par_range<usize>(0, 1000000).try_for_each(
+        [&](usize x) -> cy::Result<void, std::string> {
+            visited.fetch_add(1, std::memory_order_relaxed);
+            if (x == 1000)
+                return cy::Err(std::string("bad item"));
+
+            return cy::Ok();
+        });
+    assert(failed.is_err() && failed.get_err() == "bad item");
+    std::printf("try_for_each stopped after %zu of 1000000 items, "
+                "succeeded!\n",
+                visited.load());
+
+    auto leftmost = cy::par_range<usize>(0, 1000000).try_for_each(
+        [](usize x) -> cy::Result<void, usize> {
+            if (x >= 300000 && x % 1000 == 0)
+                return cy::Err(x);
+
+            return cy::Ok();
+        });
+    assert(leftmost.is_err() && leftmost.get_err() == 300000);
+    std::printf("try_for_each returned the leftmost of many errors, "
+                "succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
@@ -0,0 +1,281 @@
+#include "CY/pipeline.hpp"
+#include "CY/safety.hpp"
+#include "CY/spsc_queue.hpp"
+#include "CY/thread_pool.hpp"
+#include "CY/types.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Record
+{
+    uint64      id;
+    std::string name;
+    bool        enriched = false;
+};
+
+/**
+ * @brief Lines "<id>,<name>", every 10th of them broken.
+ */
+cy::Maybe<std::string> NextLine(uint64 &line, uint64 count)
+{
+    if (line == count)
+        return cy::None();
+
+    uint64 id = line++;
+    if (id % 10 == 7)
+        return cy::Some(std::string("garbage"));
+
+    return cy::Some(std::to_string(id) + ",item" + std::to_string(id));
+}
+
+cy::Result<Record, std::string> Parse(std::string line)
+{
+    usize comma = line.find(',');
+    if (comma == std::string::npos)
+        return cy::Err("no comma in '" + line + "'");
+
+    return cy::Ok(
+        Record{ std::stoull(line.substr(0, comma)), line.substr(comma + 1) });
+}
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "Pipeline-------------------------\n\n");
+
+    cy::SpscQueue<std::string> queue(3);
+    assert(queue.capacity() == 4);
+    auto popped = queue.try_pop();
+    assert(popped.is_none());
+    for (usize i = 0; i < 4; i++) {
+        bool pushed = queue.try_push(std::to_string(i));
+        assert(pushed);
+    }
+
+    std::string rejected = "rejected";
+    bool        pushed = queue.try_push(std::move(rejected));
+    assert(!pushed && rejected == "rejected");
+    assert(queue.is_full());
+    popped = queue.try_pop();
+    assert(popped.get() == "0");
+    pushed = queue.try_push(std::string("4"));
+    assert(pushed);
+    assert(queue.len() == 4);
+    std::printf("SpscQueue bounds succeeded!\n");
+
+    {
+        constexpr uint64   ITEMS = 200000;
+        cy::SpscQueue<uint64> numbers(64);
+        std::thread           producer([&]() {
+            for (uint64 i = 0; i < ITEMS;) {
+                if (numbers.try_push(i))
+                    i++;
+                else
+                    std::this_thread::yield();
+            }
+        });
+
+        for (uint64 expected = 0; expected < ITEMS;) {
+            auto item = numbers.try_pop();
+            if (item.is_some()) {
+                assert(item.get() == expected);
+                expected++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        assert(numbers.is_empty());
+    }
+    std::printf("SpscQueue keeps order across threads, succeeded!\n");
+
+    {
+        uint64 line = 0;
+        uint64 written = 0;
+        uint64 sum = 0;
+
+        auto pipeline =
+            cy::Pipeline<std::string>::from(
+                "read",
+                [&]() { return NextLine(line, 10000); },
+                cy::PipelineOptions{ 32, 4 })
+                .stage("parse", Parse)
+                .stage("enrich",
+                       [](Record record) -> cy::Result<Record, std::string> {
+                           if (record.id % 100 == 99)
+                               return cy::Err(std::string("no such item"));
+
+                           record.enriched = true;
+                           return cy::Ok(std::move(record));
+                       })
+                .sink("write",
+                      [&](Record record) -> cy::Result<void, std::string> {
+                          assert(record.enriched);
+                          written++;
+                          sum += record.id;
+                          return cy::Ok();
+                      });
+
+        assert(pipeline.len() == 4);
+        pipeline.run();
+
+        // 1000 broken lines, and 100 ids ending in 99 (none ending in 7).
+        assert(written == 8900);
+
+        auto letters = pipeline.take_dead_letters();
+        assert(letters.size() == 1100);
+        usize parse_errors = 0;
+        for (auto const &letter : letters) {
+            if (letter.stage == 1) {
+                assert(letter.stage_name == "parse");
+                assert(letter.error == "no comma in 'garbage'");
+                parse_errors++;
+            } else {
+                assert(letter.stage == 2);
+                assert(letter.stage_name == "enrich");
+            }
+        }
+        assert(parse_errors == 1000);
+        letters = pipeline.take_dead_letters();
+        assert(letters.empty());
+
+        auto metrics = pipeline.metrics();
+        assert(metrics.size() == 4);
+        assert(metrics[0].name == "read");
+        assert(metrics[0].items_out == 10000);
+        assert(metrics[1].items_in == 10000 && metrics[1].errors == 1000);
+        assert(metrics[2].items_in == 9000 && metrics[2].items_out == 8900);
+        assert(metrics[3].items_in == 8900 && metrics[3].errors == 0);
+        for (auto const &stage : metrics) {
+            assert(stage.queue_depth == 0);
+            // The queue, plus the batch waiting for room in it.
+            assert(stage.max_queue_depth <= (4 + 1) * 32);
+            assert(stage.elapsed >= stage.busy);
+            assert(stage.throughput() > 0);
+        }
+
+        bool thrown = false;
+        try {
+            pipeline.run();
+        } catch (std::runtime_error const &) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    std::printf("Ok values flow, Errs become dead letters, succeeded!\n");
+
+    {
+        // One item per batch and one batch per queue: the source keeps
+        // waiting for the slow sink.
+        uint64 next = 0;
+        uint64 last = 0;
+        auto   pipeline =
+            cy::Pipeline<int32>::from(
+                "count",
+                [&]() -> cy::Maybe<std::unique_ptr<uint64>> {
+                    if (next == 200)
+                        return cy::None();
+                    return cy::Some(std::make_unique<uint64>(next++));
+                },
+                cy::PipelineOptions{ 1, 1 })
+                .sink("check",
+                      [&](std::unique_ptr<uint64> value)
+                          -> cy::Result<void, int32> {
+                          if (*value % 50 == 0)
+                              std::this_thread::yield();
+                          assert(*value == 0 || *value == last + 1);
+                          last = *value;
+                          return cy::Ok();
+                      });
+
+        std::vector<usize> letters;
+        pipeline.on_dead_letter([&](cy::DeadLetter<int32> letter) {
+            letters.push_back(letter.stage);
+        });
+
+        cy::ThreadPool pool(2);
+        pipeline.run(pool);
+        assert(last == 199);
+        assert(letters.empty());
+        assert(pipeline.metrics()[1].max_queue_depth <= 2);
+    }
+    std::printf("Backpressure with move-only items on a pool succeeded!\n");
+
+    {
+        // A source that runs dry hands on what it has, not waiting for a
+        // full batch.
+        std::atomic<uint64> seen{ 0 };
+        uint64              next = 0;
+        bool                flushed = false;
+        cy::Instant         start = cy::Instant::now();
+        auto                pipeline =
+            cy::Pipeline<int32>::from_poll(
+                "trickle",
+                [&]() -> cy::Maybe<cy::Maybe<uint64>> {
+                    if (next < 3)
+                        return cy::Some(cy::Maybe<uint64>(cy::Some(next++)));
+
+                    flushed = seen.load() == 3;
+                    if (flushed ||
+                        start.elapsed() > cy::Duration::from_secs(5))
+                        return cy::None();
+
+                    std::this_thread::yield();
+                    return cy::Some(cy::Maybe<uint64>(cy::None()));
+                })
+                .sink("count", [&](uint64) -> cy::Result<void, int32> {
+                    seen++;
+                    return cy::Ok();
+                });
+
+        pipeline.run();
+        assert(flushed && seen.load() == 3);
+    }
+    std::printf("Polled sources hand on partial batches, succeeded!\n");
+
+    {
+        uint64 next = 0;
+        auto   pipeline =
+            cy::Pipeline<int32>::from("numbers",
+                                      [&]() -> cy::Maybe<uint64> {
+                                          return cy::Some(next++);
+                                      })
+                .stage("explode",
+                       [](uint64 value) -> cy::Result<uint64, int32> {
+                           if (value == 5000)
+                               throw std::overflow_error("too big");
+                           return cy::Ok(value);
+                       })
+                .sink("drop",
+                      [](uint64) -> cy::Result<void, int32> {
+                          return cy::Ok();
+                      });
+
+        bool thrown = false;
+        try {
+            pipeline.run();
+        } catch (std::overflow_error const &) {
+            thrown = true;
+        }
+        assert(thrown);
+
+        cy::ThreadPool small(1);
+        thrown = false;
+        try {
+            pipeline.start(small);
+        } catch (std::invalid_argument const &) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    std::printf("A throwing stage stops the pipeline, succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
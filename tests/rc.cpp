@@ -0,0 +1,116 @@
+#include "CY/rc.hpp"
+#include "CY/safety.hpp"
+#include "CY/types.hpp"
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+usize alive = 0;
+
+struct Tracked
+{
+    int32 value;
+
+    Tracked(int32 value)
+        : value(value)
+    {
+        alive++;
+    }
+    ~Tracked() { alive--; }
+};
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "Rc/Arc-------------------------\n\n");
+
+    static_assert(sizeof(cy::Rc<int32>) == sizeof(void *));
+    static_assert(sizeof(cy::Maybe<cy::Rc<int32>>) == sizeof(void *));
+    static_assert(sizeof(cy::Maybe<cy::Arc<int32>>) == sizeof(void *));
+
+    {
+        auto a = cy::make_rc<Tracked>(5);
+        auto b = a;
+        assert(a.ptr_eq(b) && a.strong_count() == 2);
+        assert(b->value == 5 && alive == 1);
+
+        auto weak = a.downgrade();
+        assert(a.weak_count() == 1);
+
+        auto upgraded = weak.upgrade();
+        assert(upgraded.is_some() && a.strong_count() == 3);
+        auto strong = upgraded.unwrap();
+        assert(upgraded.is_none() && strong.ptr_eq(a));
+
+        a = cy::make_rc<Tracked>(6);
+        b = a;
+        strong = a;
+        assert(alive == 1 && weak.strong_count() == 0);
+        assert(weak.upgrade().is_none());
+        std::printf("Upgrading a dead WeakRc gave None, succeeded!\n");
+    }
+    assert(alive == 0);
+
+    {
+        // `None` is a null block: copying it must not touch the counts.
+        cy::Maybe<cy::Rc<Tracked>> none;
+        cy::Maybe<cy::Rc<Tracked>> copy = none;
+        assert(copy.is_none());
+
+        cy::Maybe<cy::Rc<Tracked>> some = cy::Some(cy::make_rc<Tracked>(7));
+        some = none;
+        assert(some.is_none() && alive == 0);
+
+        cy::Maybe<cy::WeakRc<Tracked>> no_weak;
+        cy::Maybe<cy::WeakRc<Tracked>> weak_copy = no_weak;
+        assert(weak_copy.is_none());
+
+        auto rc = cy::make_rc<Tracked>(8);
+
+        cy::Maybe<cy::WeakRc<Tracked>> weak = cy::Some(rc.downgrade());
+        weak = no_weak;
+        assert(weak.is_none() && rc.weak_count() == 0);
+
+        // Moved-from pointers copy to moved-from ones, and upgrade to None.
+        auto moved = std::move(rc);
+        auto empty = rc;
+        (void)empty;
+
+        auto downgraded = moved.downgrade();
+        auto taken = std::move(downgraded);
+        auto empty_weak = downgraded;
+        assert(downgraded.upgrade().is_none());
+        assert(empty_weak.upgrade().is_none());
+        assert(taken.upgrade().is_some());
+        std::printf("Copying None and moved-from pointers succeeded!\n");
+    }
+    assert(alive == 0);
+
+    {
+        auto shared = cy::make_arc<std::string>("shared between threads");
+        auto weak = shared.downgrade();
+
+        std::vector<std::thread> threads;
+        for (usize i = 0; i < 4; i++) {
+            threads.emplace_back([shared, weak]() {
+                for (usize j = 0; j < 10000; j++) {
+                    auto copy = shared;
+                    auto upgraded = weak.upgrade();
+                    assert(upgraded.is_some());
+                    assert(copy.get().size() == upgraded.get()->size());
+                }
+            });
+        }
+        for (auto &thread : threads)
+            thread.join();
+
+        assert(shared.strong_count() == 1 && shared.weak_count() == 1);
+        std::printf("Arc count is %zu after threads, succeeded!\n",
+                    shared.strong_count());
+    }
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
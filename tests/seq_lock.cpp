@@ -0,0 +1,117 @@
+#include "CY/safety.hpp"
+#include "CY/seq_lock.hpp"
+#include "CY/types.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Every field holds the same number, so a torn read shows.
+ */
+struct Quote
+{
+    uint64 sequence;
+    uint64 bid;
+    uint64 ask;
+    uint32 size;
+};
+
+Quote MakeQuote(uint64 n)
+{
+    return Quote{ n, n, n, static_cast<uint32>(n) };
+}
+
+bool IsConsistent(Quote const &quote)
+{
+    return quote.bid == quote.sequence && quote.ask == quote.sequence &&
+           quote.size == static_cast<uint32>(quote.sequence);
+}
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "SeqLock-------------------------\n\n");
+
+    cy::SeqLock<Quote> lock(MakeQuote(7));
+    assert(lock.version() == 0);
+    assert(lock.read().ask == 7);
+
+    lock.write(MakeQuote(8));
+    assert(lock.version() == 1);
+    assert(lock.read().bid == 8);
+    assert(lock.try_read(0).unwrap().sequence == 8);
+    std::printf("Single-threaded reads and writes succeeded!\n");
+
+    cy::SeqLock<uint8> small;
+    small.write(200);
+    assert(small.read() == 200);
+    std::printf("Values smaller than a word succeeded!\n");
+
+    {
+        constexpr uint64   WRITES = 20000;
+        std::atomic<bool>  done{ false };
+        std::atomic<usize> skipped{ 0 };
+
+        std::vector<std::thread> readers;
+        for (usize r = 0; r < 3; r++) {
+            readers.emplace_back([&, r]() {
+                uint64 last = 0;
+                while (!done.load()) {
+                    if (r == 0) {
+                        auto quote = lock.try_read(1);
+                        if (quote.is_none()) {
+                            skipped++;
+                            continue;
+                        }
+                        assert(IsConsistent(quote.get()));
+                        continue;
+                    }
+
+                    Quote quote = lock.read();
+                    assert(IsConsistent(quote));
+                    // A single writer: values never go back in time.
+                    assert(quote.sequence >= last);
+                    last = quote.sequence;
+                }
+            });
+        }
+
+        for (uint64 i = 9; i < 9 + WRITES; i++) {
+            lock.write(MakeQuote(i));
+            if (i % 64 == 0)
+                std::this_thread::yield();
+        }
+        done.store(true);
+        for (auto &reader : readers)
+            reader.join();
+
+        assert(lock.version() == 1 + WRITES);
+        assert(IsConsistent(lock.read()));
+        std::printf("Concurrent reads are never torn (%zu skipped), "
+                    "succeeded!\n",
+                    skipped.load());
+    }
+
+    {
+        cy::SeqLock<uint64>      counter;
+        std::vector<std::thread> writers;
+        for (usize w = 0; w < 4; w++) {
+            writers.emplace_back([&]() {
+                for (usize i = 0; i < 1000; i++)
+                    counter.write(counter.read() + 1);
+            });
+        }
+        for (auto &writer : writers)
+            writer.join();
+
+        // Writes take turns, but read-then-write is not atomic.
+        assert(counter.version() == 4000);
+        assert(counter.read() <= 4000);
+    }
+    std::printf("Concurrent writers take turns, succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
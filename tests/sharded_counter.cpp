@@ -0,0 +1,72 @@
+#include "CY/cache_padded.hpp"
+#include "CY/safety.hpp"
+#include "CY/sharded_counter.hpp"
+#include "CY/types.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+cy::Result<int32, str> Check(int32 value)
+{
+    if (value % 3 == 0)
+        return cy::Err("multiple of three");
+
+    return cy::Ok(value);
+}
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "ShardedCounter-------------------------\n\n");
+
+    static_assert(alignof(cy::CachePadded<uint8>) == cy::CACHE_LINE_SIZE);
+    static_assert(sizeof(cy::CachePadded<uint8>) == cy::CACHE_LINE_SIZE);
+
+    cy::CachePadded<uint8> pair[2];
+    assert(reinterpret_cast<uintptr_t>(&pair[1].get()) -
+               reinterpret_cast<uintptr_t>(&pair[0].get()) >=
+           cy::CACHE_LINE_SIZE);
+    std::printf("CACHE_LINE_SIZE == %zu\n", cy::CACHE_LINE_SIZE);
+
+    cy::ShardedCounter counter;
+    cy::ResultCounter  results;
+
+    std::vector<std::thread> threads;
+    for (usize t = 0; t < 8; t++) {
+        threads.emplace_back([&counter, &results]() {
+            for (int32 i = 0; i < 30000; i++) {
+                counter.add();
+                (void)results.record(Check(i));
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    assert(counter.load() == 8 * 30000);
+    assert(results.err_count() == 8 * 10000);
+    assert(results.ok_count() == 8 * 20000);
+    std::printf("%zu increments over %zu shards, succeeded!\n",
+                static_cast<usize>(counter.load()),
+                counter.shards());
+
+    counter.reset();
+    assert(counter.load() == 0);
+
+    auto kept = results.record(Check(4));
+    assert(kept.unwrap() == 4);
+    auto named = results.record(cy::Result<std::string, std::string>(
+        cy::Err(std::string("refused"))));
+    assert(named.unwrap_err() == "refused");
+    auto done = results.record(cy::Result<void, std::string>(cy::Ok()));
+    assert(done.is_ok());
+    assert(results.ok_count() == 8 * 20000 + 2);
+    assert(results.err_count() == 8 * 10000 + 1);
+    std::printf("record() hands the Result back, succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
@@ -0,0 +1,210 @@
+#include "CY/safety.hpp"
+#include "CY/small_vector.hpp"
+#include "CY/span.hpp"
+#include "CY/types.hpp"
+#include <cassert>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+usize alive = 0;
+
+struct Tracked
+{
+    std::string name;
+
+    Tracked(std::string name)
+        : name(std::move(name))
+    {
+        alive++;
+    }
+
+    Tracked(Tracked const &other)
+        : name(other.name)
+    {
+        alive++;
+    }
+
+    Tracked(Tracked &&other) noexcept
+        : name(std::move(other.name))
+    {
+        alive++;
+    }
+
+    ~Tracked() { alive--; }
+};
+
+/**
+ * @brief An element whose copies and moves may throw: the `fails_in`-th
+ * one from now does.
+ */
+struct Fragile
+{
+    static inline usize fails_in = 0;
+
+    std::string name;
+
+    static void tick()
+    {
+        if (fails_in > 0 && --fails_in == 0)
+            throw std::runtime_error("copy failed");
+    }
+
+    Fragile(std::string name)
+        : name(std::move(name))
+    {
+        alive++;
+    }
+
+    Fragile(Fragile const &other)
+        : name(other.name)
+    {
+        tick();
+        alive++;
+    }
+
+    Fragile(Fragile &&other)
+        : name(std::move(other.name))
+    {
+        tick();
+        alive++;
+    }
+
+    ~Fragile() { alive--; }
+};
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "SmallVector-------------------------\n\n");
+
+    cy::SmallVector<int32, 4> small;
+    assert(small.is_empty() && small.capacity() == 4 && small.is_inline());
+    for (int32 i = 0; i < 4; i++)
+        small.push_back(i);
+    assert(small.is_inline() && small.len() == 4);
+
+    small.push_back(4);
+    assert(!small.is_inline() && small.capacity() == 8);
+    for (int32 i = 0; i < 5; i++)
+        assert(small[i] == i);
+    std::printf("Spilling to the heap succeeded!\n");
+
+    int32 &pushed = small.try_push_back(5).unwrap();
+    assert(pushed == 5 && &pushed == &small[5]);
+    auto reserved = small.try_reserve(8);
+    assert(reserved.is_ok() && small.capacity() == 8);
+
+    usize too_many = cy::SmallVector<int32, 4>::max_len() + 1;
+    auto  error = small.try_reserve(too_many);
+    assert(error.is_err() && error.get_err().capacity == too_many);
+    assert(small.len() == 6 && small[5] == 5);
+    std::printf("try_push_back and try_reserve succeeded!\n");
+
+    auto popped = small.pop_back();
+    assert(popped.get() == 5);
+    assert(small.try_at(4).unwrap() == 4);
+    assert(small.try_at(5).is_none());
+
+    cy::SmallVector<int32, 2> empty;
+    popped = empty.pop_back();
+    assert(popped.is_none());
+    std::printf("pop_back and try_at succeeded!\n");
+
+    // Elements that aren't trivially copyable, inline and on the heap.
+    {
+        cy::SmallVector<Tracked, 2> names;
+        names.emplace_back("a");
+        names.push_back(Tracked("b"));
+        assert(alive == 2 && names.is_inline());
+
+        // Appending an element of the vector itself while growing.
+        names.push_back(names[0]);
+        assert(alive == 3 && !names.is_inline());
+        assert(names[0].name == "a" && names[2].name == "a");
+
+        cy::SmallVector<Tracked, 2> copy = names;
+        assert(alive == 6 && copy[1].name == "b");
+
+        cy::SmallVector<Tracked, 2> moved = std::move(copy);
+        assert(alive == 6 && copy.is_empty() && copy.is_inline());
+        assert(moved.len() == 3 && moved[2].name == "a");
+
+        {
+            auto last = moved.pop_back();
+            assert(last.get().name == "a");
+        }
+        assert(alive == 5);
+
+        cy::SmallVector<Tracked, 4> inline_names;
+        inline_names.emplace_back("c");
+        cy::SmallVector<Tracked, 4> taken = std::move(inline_names);
+        assert(alive == 6 && taken.is_inline() && taken[0].name == "c");
+        assert(inline_names.is_empty());
+
+        names = moved;
+        assert(alive == 5 && names.len() == 2 && names[1].name == "b");
+        names.clear();
+        assert(alive == 3 && names.capacity() == 4);
+    }
+    assert(alive == 0);
+    std::printf("Non-trivial elements succeeded!\n");
+
+    // A throw while growing or moving leaves the elements where they were.
+    {
+        cy::SmallVector<Fragile, 2> names;
+        names.emplace_back("a");
+        names.emplace_back("b");
+
+        bool thrown = false;
+        Fragile::fails_in = 2;
+        try {
+            names.emplace_back("c");
+        } catch (std::runtime_error const &) {
+            thrown = true;
+        }
+        assert(thrown && alive == 2);
+        assert(names.is_inline() && names.len() == 2);
+        assert(names[0].name == "a" && names[1].name == "b");
+
+        thrown = false;
+        Fragile::fails_in = 2;
+        try {
+            names.reserve(16);
+        } catch (std::runtime_error const &) {
+            thrown = true;
+        }
+        assert(thrown && alive == 2 && names.capacity() == 2);
+        assert(names[0].name == "a" && names[1].name == "b");
+
+        thrown = false;
+        Fragile::fails_in = 2;
+        try {
+            cy::SmallVector<Fragile, 2> moved = std::move(names);
+        } catch (std::runtime_error const &) {
+            thrown = true;
+        }
+        assert(thrown && alive == 2 && names.len() == 2);
+        assert(names[0].name == "a" && names[1].name == "b");
+
+        names.emplace_back("c");
+        assert(alive == 3 && !names.is_inline() && names[2].name == "c");
+    }
+    assert(alive == 0);
+    std::printf("Throwing copies leave the vector as it was, succeeded!\n");
+
+    cy::SmallVector<int32, 3> list = { 1, 2, 3, 4 };
+    int32                     sum = 0;
+    for (int32 x : cy::Span<int32 const>(list))
+        sum += x;
+    assert(sum == 10 && list.len() == 4);
+
+    cy::SmallVector<int32, 3> other;
+    other = std::move(list);
+    assert(other.len() == 4 && list.is_empty() && list.is_inline());
+    std::printf("Iteration and moves succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
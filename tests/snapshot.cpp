@@ -0,0 +1,173 @@
+#include "CY/epoch.hpp"
+#include "CY/safety.hpp"
+#include "CY/snapshot.hpp"
+#include "CY/types.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief A config whose entries all equal `version`, counting the live ones
+ * (a moved-from config doesn't count).
+ */
+struct Config
+{
+    static inline std::atomic<int64> alive{ 0 };
+
+    uint64              version;
+    std::vector<uint64> entries;
+
+    explicit Config(uint64 version)
+        : version(version)
+        , entries(16, version)
+    {
+        alive++;
+    }
+
+    Config(Config const &other)
+        : version(other.version)
+        , entries(other.entries)
+    {
+        alive++;
+    }
+
+    Config(Config &&other)
+        : version(other.version)
+        , entries(std::move(other.entries))
+    {
+        other.entries.clear();
+    }
+
+    ~Config()
+    {
+        if (this->entries.empty())
+            return;
+
+        // A reader of a freed config would see this.
+        for (auto &entry : this->entries)
+            entry = ~uint64(0);
+        alive--;
+    }
+
+    bool is_consistent() const
+    {
+        for (uint64 entry : this->entries) {
+            if (entry != this->version)
+                return false;
+        }
+        return true;
+    }
+};
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "Snapshot-------------------------\n\n");
+
+    cy::Collector &collector = cy::Collector::global();
+
+    {
+        cy::Snapshot<Config> config(Config(1));
+        assert(config.load()->version == 1);
+
+        {
+            auto old = config.load();
+            config.store(Config(2));
+
+            // The guard keeps version 1 alive.
+            assert(old->version == 1 && old->is_consistent());
+            assert(config.load()->version == 2);
+            collector.collect();
+            assert(collector.pending() == 1);
+            assert(Config::alive.load() == 2);
+        }
+
+        collector.collect();
+        assert(collector.pending() == 0);
+        assert(Config::alive.load() == 1);
+        std::printf("Guards keep old versions alive, succeeded!\n");
+
+        auto failed = config.try_update(
+            [](Config const &current) -> cy::Result<Config, std::string> {
+                if (current.version == 2)
+                    return cy::Err(std::string("parse error"));
+                return cy::Ok(Config(current.version + 1));
+            });
+        assert(failed.is_err());
+        assert(failed.get_err() == "parse error");
+        assert(config.load()->version == 2);
+
+        auto updated = config.try_update(
+            [](Config const &current) -> cy::Result<Config, std::string> {
+                return cy::Ok(Config(current.version + 1));
+            });
+        assert(updated.is_ok());
+        assert(config.load()->version == 3);
+        std::printf("Failed updates keep the old version, succeeded!\n");
+
+        {
+            auto outer = collector.pin();
+            auto inner = config.load();
+            config.store(Config(4));
+            collector.collect();
+            assert(collector.pending() == 1);
+        }
+        collector.collect();
+        assert(collector.pending() == 0);
+        std::printf("Nested pins succeeded!\n");
+    }
+    collector.collect();
+    assert(Config::alive.load() == 0);
+    std::printf("Dropping the snapshot frees the last version, succeeded!\n");
+
+    {
+        cy::Snapshot<Config> config(Config(0));
+        std::atomic<bool>    done{ false };
+        std::atomic<uint64>  reads{ 0 };
+
+        std::vector<std::thread> readers;
+        for (usize r = 0; r < 3; r++) {
+            readers.emplace_back([&]() {
+                uint64 last = 0;
+                while (!done.load()) {
+                    auto current = config.load();
+                    assert(current->is_consistent());
+                    assert(current->version >= last);
+                    last = current->version;
+                    reads.fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+
+        for (uint64 version = 1; version <= 2000; version++) {
+            if (version % 2 == 0) {
+                config.store(Config(version));
+            } else {
+                (void)config.try_update(
+                    [&](Config const &) -> cy::Result<Config, int32> {
+                        return cy::Ok(Config(version));
+                    });
+            }
+            if (version % 16 == 0)
+                std::this_thread::yield();
+        }
+        done.store(true);
+        for (auto &reader : readers)
+            reader.join();
+
+        assert(config.load()->version == 2000);
+        std::printf("Concurrent readers see whole versions (%llu reads), "
+                    "succeeded!\n",
+                    static_cast<unsigned long long>(reads.load()));
+    }
+    collector.collect();
+    assert(Config::alive.load() == 0);
+    assert(collector.pending() == 0);
+    std::printf("Every version freed, succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
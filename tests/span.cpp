@@ -0,0 +1,69 @@
+#include "CY/safety.hpp"
+#include "CY/span.hpp"
+#include "CY/types.hpp"
+#include <array>
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+float32 Dot(cy::Span<float32 const> a, cy::Span<float32 const> b, usize n)
+{
+    float32 sum = 0;
+    auto    checked = cy::with_checked_range(a, n, [&](auto a_n) {
+        return cy::with_checked_range(b, n, [&](auto b_n) {
+            for (usize i = 0; i < n; i++)
+                sum += a_n[i] * b_n[i];
+        });
+    });
+
+    assert(checked.is_some() && checked.unwrap());
+    return sum;
+}
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "Span-------------------------\n\n");
+
+    std::vector<int32> values = { 1, 2, 3, 4, 5 };
+    cy::Span           span(values);
+    static_assert(std::is_same_v<decltype(span), cy::Span<int32>>);
+    assert(span.len() == 5 && !span.is_empty());
+
+    assert(span.try_at(4).unwrap() == 5);
+    assert(span.try_at(5).is_none());
+    span.try_at(0).get() = 10;
+    assert(values[0] == 10);
+    std::printf("try_at succeeded!\n");
+
+    cy::Span<int32 const> view = span;
+    auto                  middle = view.try_subspan(1, 3).unwrap();
+    assert(middle.len() == 3 && middle[0] == 2 && middle[2] == 4);
+    assert(view.try_subspan(5).unwrap().is_empty());
+    assert(view.try_subspan(4, 2).is_none());
+    assert(view.try_subspan(6).is_none());
+    std::printf("try_subspan succeeded!\n");
+
+    auto [left, right] = view.split_at(2).unwrap();
+    assert(left.len() == 2 && right.len() == 3 && right[0] == 3);
+    assert(view.split_at(6).is_none());
+    std::printf("split_at succeeded!\n");
+
+    int32 array[] = { 1, 2, 3 };
+    int32 sum = 0;
+    for (int32 x : cy::Span(array))
+        sum += x;
+    assert(sum == 6);
+
+    std::array<float32, 4> a = { 1, 2, 3, 4 };
+    std::vector<float32>   b = { 1, 1, 1, 1, 1 };
+    assert(Dot(a, b, 4) == 10);
+    assert(cy::with_checked_range(cy::Span<float32 const>(a),
+                                  5,
+                                  [](auto) { return 0; })
+               .is_none());
+    std::printf("with_checked_range succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include "CY/hash.hpp"
+#include "CY/string_switch.hpp"
+#include "CY/types.hpp"
+#include <cassert>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+constexpr auto COMMANDS =
+    cy::string_switch("start", "stop", "status", "restart", "reload", "");
+
+str Describe(strview command)
+{
+    auto index = COMMANDS.match(command);
+    if (index.is_none())
+        return "unknown";
+
+    switch (index.unwrap()) {
+        case COMMANDS.index("start"):
+        case COMMANDS.index("restart"):
+            return "starting";
+        case COMMANDS.index("stop"):
+            return "stopping";
+        default:
+            return "other";
+    }
+}
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "StringSwitch-------------------------\n\n");
+
+    static_assert(cy::fnv1a("") == 0xcbf29ce484222325);
+    static_assert(cy::fnv1a("a") == 0xaf63dc4c8601ec8c);
+    static_assert(cy::fnv1a("stop") != cy::fnv1a("stoq"));
+    std::printf("Compile-time fnv1a succeeded!\n");
+
+    static_assert(COMMANDS.len() == 6);
+    static_assert(COMMANDS.index("reload") == 4);
+    for (usize i = 0; i < COMMANDS.len(); i++)
+        assert(COMMANDS.match(COMMANDS.key(i)).unwrap() == i);
+
+    std::string owned = "status";
+    assert(COMMANDS.match(owned).unwrap() == 2);
+    assert(COMMANDS.match("stat").is_none());
+    assert(COMMANDS.match("statuses").is_none());
+    assert(COMMANDS.match("STOP").is_none());
+    assert(COMMANDS.match("").unwrap() == 5);
+    assert(COMMANDS.match(strview()).unwrap() == 5);
+    std::printf("match succeeded!\n");
+
+    assert(std::string(Describe("restart")) == "starting");
+    assert(std::string(Describe("stop")) == "stopping");
+    assert(std::string(Describe("status")) == "other");
+    assert(std::string(Describe("halt")) == "unknown");
+    std::printf("switch on index() succeeded!\n");
+
+    constexpr auto MANY = cy::string_switch(
+        "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7", "a8", "a9", "b0", "b1",
+        "b2", "b3", "b4", "b5", "b6", "b7", "b8", "b9", "c0", "c1", "c2", "c3",
+        "c4", "c5", "c6", "c7", "c8", "c9", "d0", "d1", "d2", "d3", "d4", "d5",
+        "d6", "d7", "d8", "d9", "e0", "e1", "e2", "e3", "e4", "e5", "e6", "e7");
+    for (usize i = 0; i < MANY.len(); i++)
+        assert(MANY.match(MANY.key(i)).unwrap() == i);
+    assert(MANY.match("e8").is_none());
+    std::printf("Full table succeeded!\n");
+
+    bool thrown = false;
+    try {
+        (void)cy::string_switch("same", "other", "same");
+    } catch (std::invalid_argument const &) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::printf("Duplicate keys throw, succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
@@ -0,0 +1,264 @@
+#include "CY/safety.hpp"
+#include "CY/task_graph.hpp"
+#include "CY/thread_pool.hpp"
+#include "CY/types.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using Error = std::string;
+
+/**
+ * @brief Counts its copies, to check values are moved along single edges.
+ */
+struct Tracked
+{
+    static inline std::atomic<usize> copies{ 0 };
+
+    std::vector<int32> items;
+
+    Tracked(std::vector<int32> items)
+        : items(std::move(items))
+    {
+    }
+
+    Tracked(Tracked const &other)
+        : items(other.items)
+    {
+        copies++;
+    }
+
+    Tracked(Tracked &&) = default;
+};
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "TaskGraph-------------------------\n\n");
+
+    cy::ThreadPool pool(4);
+
+    {
+        cy::TaskGraph<Error> graph;
+
+        auto numbers = graph.add([]() -> cy::Result<Tracked, Error> {
+            return cy::Ok(Tracked({ 1, 2, 3, 4 }));
+        });
+        auto doubled =
+            graph.add([](Tracked in) -> cy::Result<Tracked, Error> {
+                for (auto &item : in.items)
+                    item *= 2;
+                return cy::Ok(std::move(in));
+            },
+                      numbers);
+        auto sum = graph.add([](Tracked const &in) -> cy::Result<int32, Error> {
+            int32 total = 0;
+            for (int32 item : in.items)
+                total += item;
+            return cy::Ok(total);
+        },
+                             doubled);
+        auto count = graph.add(
+            [](Tracked const &in) -> cy::Result<usize, Error> {
+                return cy::Ok(in.items.size());
+            },
+            doubled);
+        auto mean = graph.add(
+            [](int32 total, usize n) -> cy::Result<int32, Error> {
+                return cy::Ok(total / static_cast<int32>(n));
+            },
+            sum,
+            count);
+
+        assert(graph.len() == 5);
+        auto ran = graph.run(pool);
+        assert(ran.is_ok());
+        auto mean_value = graph.take(mean);
+        auto sum_value = graph.take(sum);
+        assert(mean_value.get() == 5 && sum_value.is_none());
+        assert(graph.skipped() == 0);
+
+        // One copy for the two consumers of `doubled`; the rest are moves.
+        assert(Tracked::copies.load() == 1);
+
+        bool thrown = false;
+        try {
+            (void)graph.run(pool);
+        } catch (std::runtime_error const &) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+    std::printf("Values flow along edges succeeded!\n");
+
+    {
+        cy::TaskGraph<Error> graph;
+        std::atomic<usize>   ran{ 0 };
+
+        auto ok = graph.add([&]() -> cy::Result<int32, Error> {
+            ran++;
+            return cy::Ok(1);
+        });
+        auto failing = graph.add([&](int32) -> cy::Result<int32, Error> {
+            ran++;
+            return cy::Err(Error("parse failed"));
+        },
+                                 ok);
+        auto skipped = graph.add([&](int32) -> cy::Result<void, Error> {
+            ran++;
+            return cy::Ok();
+        },
+                                 failing);
+        graph.add([&]() -> cy::Result<void, Error> {
+            ran++;
+            return cy::Ok();
+        },
+                  skipped);
+        auto other = graph.add([&]() -> cy::Result<int32, Error> {
+            ran++;
+            return cy::Err(Error("disk full"));
+        });
+        auto independent = graph.add([&](int32 x) -> cy::Result<int32, Error> {
+            ran++;
+            return cy::Ok(x + 1);
+        },
+                                     ok);
+        (void)other;
+
+        auto result = graph.run(pool);
+        assert(result.is_err());
+        auto errors = result.unwrap_err();
+        assert(errors.size() == 2);
+        assert(errors[0].task == failing.id());
+        assert(errors[0].error == "parse failed");
+        assert(errors[1].error == "disk full");
+        assert(graph.skipped() == 2);
+        assert(ran.load() == 4);
+        auto value = graph.take(independent);
+        assert(value.get() == 2);
+    }
+    std::printf("Failures skip downstream tasks, succeeded!\n");
+
+    {
+        cy::TaskGraph<Error> graph;
+        auto                 boxed = graph.add(
+            []() -> cy::Result<std::unique_ptr<int32>, Error> {
+                return cy::Ok(std::make_unique<int32>(7));
+            });
+        graph.add(
+            [](std::unique_ptr<int32> value) -> cy::Result<void, Error> {
+                return *value == 7 ? cy::Result<void, Error>(cy::Ok())
+                                   : cy::Err(Error("wrong"));
+            },
+            boxed);
+
+        bool thrown = false;
+        try {
+            graph.add(
+                [](std::unique_ptr<int32>) -> cy::Result<void, Error> {
+                    return cy::Ok();
+                },
+                boxed);
+        } catch (std::invalid_argument const &) {
+            thrown = true;
+        }
+        assert(thrown);
+
+        // Passing the same move-only value twice to one task.
+        auto pair = graph.add(
+            []() -> cy::Result<std::unique_ptr<int32>, Error> {
+                return cy::Ok(std::make_unique<int32>(8));
+            });
+        thrown = false;
+        try {
+            graph.add(
+                [](std::unique_ptr<int32>,
+                   std::unique_ptr<int32>) -> cy::Result<void, Error> {
+                    return cy::Ok();
+                },
+                pair,
+                pair);
+        } catch (std::invalid_argument const &) {
+            thrown = true;
+        }
+        assert(thrown);
+        auto ran = graph.run(pool);
+        assert(ran.is_ok());
+    }
+    std::printf("Move-only values succeeded!\n");
+
+    {
+        cy::TaskGraph<Error> graph;
+        auto throwing = graph.add([]() -> cy::Result<int32, Error> {
+            throw std::out_of_range("bad index");
+        });
+        graph.add([](int32) -> cy::Result<void, Error> { return cy::Ok(); },
+                  throwing);
+
+        bool thrown = false;
+        try {
+            (void)graph.run(pool);
+        } catch (std::out_of_range const &) {
+            thrown = true;
+        }
+        assert(thrown);
+        assert(graph.skipped() == 1);
+    }
+    std::printf("Exceptions are rethrown, succeeded!\n");
+
+    {
+        // From inside a worker, run() uses that pool and helps while waiting.
+        int32 value = pool.install([]() {
+            cy::TaskGraph<Error> graph;
+            auto                 a = graph.add(
+                []() -> cy::Result<int32, Error> { return cy::Ok(20); });
+            auto b = graph.add(
+                [](int32 x) -> cy::Result<int32, Error> {
+                    return cy::Ok(x + 1);
+                },
+                a);
+            (void)graph.run();
+            return graph.take(b).unwrap() * 2;
+        });
+        assert(value == 42);
+    }
+    std::printf("Running from a worker succeeded!\n");
+
+    {
+        // Wide: many independent chains; deep: one long chain.
+        cy::TaskGraph<Error> graph;
+        std::vector<cy::Task<uint64>> heads;
+        for (uint64 i = 0; i < 1000; i++) {
+            auto head = graph.add(
+                [i]() -> cy::Result<uint64, Error> { return cy::Ok(i); });
+            heads.push_back(graph.add(
+                [](uint64 x) -> cy::Result<uint64, Error> {
+                    return cy::Ok(x * 2);
+                },
+                head));
+        }
+
+        auto chain = heads[0];
+        for (usize i = 1; i < heads.size(); i++) {
+            chain = graph.add(
+                [](uint64 a, uint64 b) -> cy::Result<uint64, Error> {
+                    return cy::Ok(a + b);
+                },
+                chain,
+                heads[i]);
+        }
+
+        auto ran = graph.run(pool);
+        assert(ran.is_ok());
+        auto last = graph.take(chain);
+        assert(last.get() == 999 * 1000);
+    }
+    std::printf("Wide and deep graphs succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
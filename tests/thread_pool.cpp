@@ -0,0 +1,127 @@
+#include "CY/chase_lev_deque.hpp"
+#include "CY/safety.hpp"
+#include "CY/thread_pool.hpp"
+#include "CY/types.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+uint64 Fib(cy::ThreadPool &pool, uint64 n)
+{
+    if (n < 12)
+        return n < 2 ? n : Fib(pool, n - 1) + Fib(pool, n - 2);
+
+    auto [a, b] = pool.join([&]() { return Fib(pool, n - 1); },
+                            [&]() { return Fib(pool, n - 2); });
+    return a + b;
+}
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "ThreadPool-------------------------\n\n");
+
+    cy::ChaseLevDeque<usize> deque(2);
+    for (usize i = 0; i < 10; i++)
+        deque.push(i);
+    assert(deque.len() == 10);
+    usize popped = deque.pop().unwrap();
+    usize stolen_first = deque.steal().unwrap();
+    usize stolen_second = deque.steal().unwrap();
+    assert(popped == 9 && stolen_first == 0 && stolen_second == 1);
+    popped = deque.pop().unwrap();
+    assert(popped == 8);
+    while (deque.pop().is_some()) {
+    }
+    assert(deque.is_empty());
+    auto none = deque.steal();
+    assert(none.is_none());
+    std::printf("ChaseLevDeque order succeeded!\n");
+
+    constexpr usize    ITEMS = 200000;
+    std::vector<uint8> seen(ITEMS, 0);
+    std::atomic<bool>  done{ false };
+    std::atomic<usize> stolen{ 0 };
+
+    std::vector<std::thread> thieves;
+    for (usize t = 0; t < 3; t++) {
+        thieves.emplace_back([&]() {
+            while (!done.load()) {
+                auto item = deque.steal();
+                if (item.is_some()) {
+                    seen[item.unwrap()]++;
+                    stolen.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (usize i = 0; i < ITEMS; i++) {
+        deque.push(i);
+        if (i % 3 == 0) {
+            auto item = deque.pop();
+            if (item.is_some())
+                seen[item.unwrap()]++;
+        }
+    }
+    for (auto item = deque.pop(); item.is_some(); item = deque.pop())
+        seen[item.unwrap()]++;
+    done.store(true);
+    for (auto &thief : thieves)
+        thief.join();
+
+    for (usize i = 0; i < ITEMS; i++)
+        assert(seen[i] == 1);
+    std::printf("Every item taken exactly once (%zu stolen), succeeded!\n",
+                stolen.load());
+
+    cy::ThreadPool pool(cy::PoolOptions{ 4, true });
+    uint64 fib = Fib(pool, 25);
+    assert(fib == 75025);
+    std::printf("Fork-join fib(25) succeeded!\n");
+
+    auto answer = pool.spawn([]() { return 42; });
+    auto text = pool.spawn([]() { return std::string("spawned"); });
+    int32       answer_value = answer.join().unwrap();
+    std::string text_value = text.join().unwrap();
+    assert(answer_value == 42 && text_value == "spawned");
+
+    bool thrown = false;
+    try {
+        (void)answer.join();
+    } catch (std::runtime_error const &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    auto failing = pool.spawn([]() -> int32 {
+        throw std::invalid_argument("task failed");
+    });
+    auto result = failing.join();
+    assert(result.is_err());
+    assert(result.get_err().message() == "task failed");
+    std::printf("spawn() gives back a Panic, succeeded!\n");
+
+    std::atomic<usize> ran{ 0 };
+    std::vector<cy::JoinHandle<void>> handles;
+    for (usize i = 0; i < 100; i++)
+        handles.push_back(pool.spawn([&ran]() { ran.fetch_add(1); }));
+
+    auto nested = pool.spawn([&pool]() {
+        return pool.spawn([]() { return 7; }).join().unwrap() * 6;
+    });
+    for (auto &handle : handles) {
+        auto joined = handle.join();
+        assert(joined.is_ok());
+    }
+    assert(ran.load() == 100);
+    int32 nested_value = nested.join().unwrap();
+    assert(nested_value == 42);
+    std::printf("Spawning from workers succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include "CY/safety.hpp"
+#include "CY/span.hpp"
+#include "CY/types.hpp"
+#include "CY/varint.hpp"
+#include <cassert>
+#include <cstdio>
+#include <vector>
+
+int32 main()
+{
+    std::printf("\n-----------------------TESTING: "
+                "Varint-------------------------\n\n");
+
+    uint8 buffer[cy::MAX_VARINT_LEN];
+    usize len = cy::encode_varint(0, buffer);
+    assert(len == 1 && buffer[0] == 0);
+    len = cy::encode_varint(300, buffer);
+    assert(len == 2 && buffer[0] == 0xac && buffer[1] == 0x02);
+    len = cy::encode_varint(UINT64_MAX, buffer);
+    assert(len == cy::MAX_VARINT_LEN);
+    assert(cy::decode_varint(buffer).unwrap().value == UINT64_MAX);
+    std::printf("Encoding succeeded!\n");
+
+    static_assert(cy::zigzag(0) == 0 && cy::zigzag(-1) == 1);
+    static_assert(cy::zigzag(1) == 2 && cy::zigzag(INT64_MIN) == UINT64_MAX);
+    static_assert(cy::unzigzag(cy::zigzag(INT64_MIN)) == INT64_MIN);
+    len = cy::encode_zigzag(-300, buffer);
+    auto signed_value = cy::decode_zigzag(cy::Span<uint8 const>(buffer, len));
+    assert(signed_value.unwrap().value == -300);
+    std::printf("Zigzag succeeded!\n");
+
+    uint8 truncated[] = { 0x80, 0x80 };
+    auto  error = cy::decode_varint(truncated);
+    assert(error.unwrap_err().kind == cy::DecodeError::Truncated);
+
+    uint8 overlong[11] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                           0xff, 0xff, 0xff, 0xff, 0x01 };
+    assert(cy::decode_varint(overlong).unwrap_err().kind ==
+           cy::DecodeError::Overlong);
+    overlong[9] = 0x02;
+    assert(cy::decode_varint(overlong).unwrap_err().kind ==
+           cy::DecodeError::Overlong);
+
+    len = cy::encode_varint(uint64(1) << 32, buffer);
+    assert(cy::decode_varint32(cy::Span<uint8 const>(buffer, len))
+               .unwrap_err()
+               .kind == cy::DecodeError::Overlong);
+    len = cy::encode_varint(UINT32_MAX, buffer);
+    assert(cy::decode_varint32(cy::Span<uint8 const>(buffer, len))
+               .unwrap()
+               .value == UINT32_MAX);
+    std::printf("Errors without exceptions succeeded!\n");
+
+    std::vector<uint64> values;
+    for (uint64 i = 0; i < 1000; i++) {
+        values.push_back(i % 100);
+        values.push_back(i * 1000003);
+        values.push_back(UINT64_MAX - i);
+        values.push_back(uint64(1) << (i % 64));
+    }
+
+    std::vector<uint8> bytes;
+    for (uint64 value : values) {
+        usize n = cy::encode_varint(value, buffer);
+        bytes.insert(bytes.end(), buffer, buffer + n);
+    }
+
+    std::vector<uint64> decoded(values.size());
+    usize count = cy::decode_all(bytes, decoded).unwrap();
+    assert(count == values.size());
+    assert(decoded == values);
+
+    // Runs of two-byte varints, decoded four to a word.
+    std::vector<uint8> pairs;
+    for (uint64 value = 128; value < 16384; value += 61) {
+        usize n = cy::encode_varint(value, buffer);
+        pairs.insert(pairs.end(), buffer, buffer + n);
+    }
+
+    std::vector<uint64> pair_values(pairs.size() / 2);
+    count = cy::decode_all(pairs, pair_values).unwrap();
+    assert(count == pair_values.size());
+    for (usize i = 0; i < count; i++)
+        assert(pair_values[i] == 128 + 61 * i);
+
+    std::vector<uint64> small(values.size() - 1);
+    auto                full = cy::decode_all(bytes, small);
+    assert(full.unwrap_err().kind == cy::DecodeError::OutputFull);
+
+    bytes.push_back(0x80);
+    decoded.push_back(0);
+    auto cut = cy::decode_all(bytes, decoded);
+    assert(cut.get_err().kind == cy::DecodeError::Truncated);
+    assert(cut.get_err().offset == bytes.size() - 1);
+    std::printf("decode_all succeeded!\n");
+
+    std::printf("\n-----------------------OK-------------------------\n");
+    return 0;
+}